@@ -0,0 +1,137 @@
+// Bridge.c
+// PC <-> hexapod passthrough, see Bridge.h
+// Each receive ISR queues its byte and enables the other UART's data register empty interrupt, which then sends
+// until its queue is empty and disables itself again.
+
+#include "Bridge.h"
+
+#include <string.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+#include "DebugUart.h"
+#include "Profiler.h"
+
+volatile bool bridgeActive = false;
+BridgeBuffer bridgeToPc;
+volatile BridgeCounts bridgeCounts;
+
+static BridgeBuffer toRobot;
+
+static inline U8 Bridge_Used(BridgeBuffer* buffer)
+{
+    return (buffer->head - buffer->tail) & (BRIDGE_BUFFER_SIZE-1);
+}
+
+void Bridge_Start()
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        memset(&toRobot, 0, sizeof(toRobot));
+        memset(&bridgeToPc, 0, sizeof(bridgeToPc));
+        memset((void*)&bridgeCounts, 0, sizeof(bridgeCounts));
+        bridgeActive = true;
+    }
+
+#ifdef BRIDGE_FLOW_CONTROL
+    BRIDGE_RTS_DDR |= BRIDGE_RTS;
+    BRIDGE_RTS_PORT &= ~BRIDGE_RTS;
+#endif
+    DebugUart_Start(BRIDGE_PC_UBRR, (1<<RXCIE0) | (1<<RXEN0) | (1<<TXEN0)); // Sent to by USART0_UDRE_vect below
+}
+
+void Bridge_Stop()
+{
+    bridgeActive = false; // First, so USART1_RX_vect stops forwarding into a port being shut down
+    DebugUart_Stop();
+    UCSR1B &= ~(1<<UDRIE1);
+#ifdef BRIDGE_FLOW_CONTROL
+    BRIDGE_RTS_PORT |= BRIDGE_RTS;
+#endif
+}
+
+void Bridge_Poll()
+{
+#ifdef BRIDGE_FLOW_CONTROL
+    if (!(BRIDGE_CTS_PIN & BRIDGE_CTS) && bridgeToPc.head != bridgeToPc.tail)
+    {
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) // USART0_UDRE_vect clears the same bit
+        {
+            UCSR0B |= (1<<UDRIE0);
+        }
+    }
+#endif
+}
+
+void Bridge_GetCounts(BridgeCounts* copy)
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        *copy = bridgeCounts;
+    }
+}
+
+// From the PC, queued for the hexapod
+ISR(USART0_RX_vect)
+{
+    PROFILE_ENTER(PROFILE_USART0_RX, LATENCY_NOT_MEASURED);
+
+    U8 c = UDR0;
+    U8 next = (toRobot.head + 1) & (BRIDGE_BUFFER_SIZE-1);
+    if (next == toRobot.tail)
+        bridgeCounts.dropped++;
+    else
+    {
+        toRobot.data[toRobot.head] = c;
+        toRobot.head = next;
+        UCSR1B |= (1<<UDRIE1);
+    }
+#ifdef BRIDGE_FLOW_CONTROL
+    if (Bridge_Used(&toRobot) >= BRIDGE_RTS_OFF) BRIDGE_RTS_PORT |= BRIDGE_RTS;
+#endif
+
+    PROFILE_EXIT(PROFILE_USART0_RX);
+}
+
+// To the PC
+ISR(USART0_UDRE_vect)
+{
+    PROFILE_ENTER(PROFILE_USART0_UDRE, LATENCY_NOT_MEASURED);
+
+#ifdef BRIDGE_FLOW_CONTROL
+    if (BRIDGE_CTS_PIN & BRIDGE_CTS) // PC wants a pause, Bridge_Poll restarts us
+    {
+        UCSR0B &= ~(1<<UDRIE0);
+        PROFILE_EXIT(PROFILE_USART0_UDRE);
+        return;
+    }
+#endif
+    if (bridgeToPc.head == bridgeToPc.tail) // Enabled with nothing left, e.g by Bridge_Poll just as we emptied it
+    {
+        UCSR0B &= ~(1<<UDRIE0);
+        PROFILE_EXIT(PROFILE_USART0_UDRE);
+        return;
+    }
+    UDR0 = bridgeToPc.data[bridgeToPc.tail];
+    bridgeToPc.tail = (bridgeToPc.tail + 1) & (BRIDGE_BUFFER_SIZE-1);
+    bridgeCounts.toPc++;
+    if (bridgeToPc.head == bridgeToPc.tail) UCSR0B &= ~(1<<UDRIE0);
+
+    PROFILE_EXIT(PROFILE_USART0_UDRE);
+}
+
+// To the hexapod
+ISR(USART1_UDRE_vect)
+{
+    PROFILE_ENTER(PROFILE_USART1_UDRE, LATENCY_NOT_MEASURED);
+
+    UDR1 = toRobot.data[toRobot.tail];
+    toRobot.tail = (toRobot.tail + 1) & (BRIDGE_BUFFER_SIZE-1);
+    bridgeCounts.toRobot++;
+    if (toRobot.head == toRobot.tail) UCSR1B &= ~(1<<UDRIE1);
+#ifdef BRIDGE_FLOW_CONTROL
+    if (Bridge_Used(&toRobot) < BRIDGE_RTS_ON) BRIDGE_RTS_PORT &= ~BRIDGE_RTS;
+#endif
+
+    PROFILE_EXIT(PROFILE_USART1_UDRE);
+}
@@ -0,0 +1,64 @@
+// Bridge.h
+// Transparent passthrough between a PC on USART0 and the hexapod radio on USART1, so the hexapod can be reflashed or
+// debugged through the handset. Both directions run entirely in interrupts through ring buffers, the main loop
+// only watches CTS and shows the counters.
+
+#ifndef BRIDGE_H
+#define BRIDGE_H
+
+#include <stdbool.h>
+#include <avr/io.h>
+
+#include "compiler.h"
+
+//#define BRIDGE_FLOW_CONTROL // RTS/CTS on the PC side, needed when BRIDGE_PC_UBRR is faster than the radio
+
+#define BRIDGE_PC_UBRR      103 // 9600 baud like the radio, from AT90CAN32/64/128 manual, page 202
+#define BRIDGE_BUFFER_SIZE  128 // Each direction, must be a power of 2 no bigger than 256
+
+#ifdef BRIDGE_FLOW_CONTROL
+#define BRIDGE_RTS          (1<<PE3) // Output, high asks the PC to pause
+#define BRIDGE_RTS_PORT     PORTE
+#define BRIDGE_RTS_DDR      DDRE
+#define BRIDGE_CTS          (1<<PE4) // Input, high when the PC wants us to pause
+#define BRIDGE_CTS_PIN      PINE
+#define BRIDGE_RTS_OFF      (BRIDGE_BUFFER_SIZE - 16) // Room for the PC's UART FIFO to drain after RTS goes high
+#define BRIDGE_RTS_ON       (BRIDGE_BUFFER_SIZE / 2)
+#endif
+
+typedef struct
+{
+    U8 data[BRIDGE_BUFFER_SIZE];
+    volatile U8 head, tail;
+} BridgeBuffer;
+
+typedef struct
+{
+    U32 toRobot, toPc; // Bytes forwarded
+    U16 dropped; // Bytes lost to full buffers, only when flow control is off or ignored
+} BridgeCounts;
+
+extern volatile bool bridgeActive;
+extern BridgeBuffer bridgeToPc;
+extern volatile BridgeCounts bridgeCounts;
+
+void Bridge_Start();
+void Bridge_Stop();
+void Bridge_Poll(); // From the main loop while active, restarts sending to the PC once it raises CTS again
+void Bridge_GetCounts(BridgeCounts* copy);
+
+// Called by USART1_RX_vect in Link.c, which owns that vector, for each byte from the hexapod while bridging
+static inline void Bridge_FromRobot(U8 c)
+{
+    U8 next = (bridgeToPc.head + 1) & (BRIDGE_BUFFER_SIZE-1);
+    if (next == bridgeToPc.tail)
+    {
+        bridgeCounts.dropped++;
+        return;
+    }
+    bridgeToPc.data[bridgeToPc.head] = c;
+    bridgeToPc.head = next;
+    UCSR0B |= (1<<UDRIE0);
+}
+
+#endif // BRIDGE_H
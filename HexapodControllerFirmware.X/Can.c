@@ -0,0 +1,129 @@
+// Can.c
+// Minimal AT90CAN CAN controller driver, extended (29-bit) ids at 500kbps
+
+#include "Can.h"
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+#include "Profiler.h"
+#include "Timebase.h"
+
+#define CAN_TX_MOB      0
+#define CAN_RX_MOBS     3 // Receive message objects after the transmit one, so frames back to back all land somewhere
+#define NUM_MOBS        15
+#define CAN_RX_QUEUE    8 // Frames held for Can_Receive, must be a power of 2
+
+typedef struct
+{
+    U8 length;
+    U8 data[8];
+    U32 time; // Timebase_Micros when it was taken from its message object
+} CanFrame;
+
+static U32 canReceiveId;
+static CanFrame rxQueue[CAN_RX_QUEUE];
+static volatile U8 rxQueueHead = 0, rxQueueTail = 0;
+
+static void Can_SetId(U32 id)
+{
+    CANIDT1 = id >> 21;
+    CANIDT2 = id >> 13;
+    CANIDT3 = id >> 5;
+    CANIDT4 = id << 3; // RTRTAG and RB0TAG left clear
+}
+
+static void Can_EnableReceive(U8 mob)
+{
+    CANPAGE = mob << 4;
+    CANSTMOB = 0;
+    Can_SetId(canReceiveId);
+    CANIDM1 = 0xFF; // Match the whole id
+    CANIDM2 = 0xFF;
+    CANIDM3 = 0xFF;
+    CANIDM4 = 0xF8 | (1<<IDEMSK);
+    CANCDMOB = (1<<CONMOB1) | (1<<IDE) | 8; // Enable reception of extended frames
+}
+
+void Can_Init(U32 receiveId)
+{
+    canReceiveId = receiveId;
+
+    CANGCON = (1<<SWRES);
+    for (U8 mob=0; mob<NUM_MOBS; mob++)
+    {
+        CANPAGE = mob << 4;
+        CANSTMOB = 0;
+        CANCDMOB = 0;
+    }
+
+    CANBT1 = 0x02; // 500kbps at 16MHz, from the AT90CAN datasheet bit timing table
+    CANBT2 = 0x0C;
+    CANBT3 = 0x37;
+
+    for (U8 mob=CAN_TX_MOB+1; mob<=CAN_TX_MOB+CAN_RX_MOBS; mob++)
+    {
+        Can_EnableReceive(mob);
+        CANIE2 |= 1<<mob; // Mobs 0 to 7 are all in CANIE2
+    }
+    CANGIE = (1<<ENIT) | (1<<ENRX);
+    CANGCON = (1<<ENASTB);
+}
+
+bool Can_Send(U32 id, const U8* data, U8 length)
+{
+    if (CANEN2 & (1<<CAN_TX_MOB)) return false; // Still busy with the last one
+
+    CANPAGE = CAN_TX_MOB << 4; // Also resets the data index, which auto increments
+    CANSTMOB = 0;
+    Can_SetId(id);
+    for (U8 n=0; n<length; n++) CANMSG = data[n];
+    CANCDMOB = (1<<CONMOB0) | (1<<IDE) | length;
+    return true;
+}
+
+// Empties each receive message object into the queue as soon as it fills, as the main loop only polls once a pass
+ISR(CANIT_vect)
+{
+    PROFILE_ENTER(PROFILE_CAN_IT, LATENCY_NOT_MEASURED); // Nothing times when the frame completed
+
+    U8 page = CANPAGE; // Can_Send may be part way through filling the transmit object
+    U32 time = Timebase_Micros();
+    for (U8 mob=CAN_TX_MOB+1; mob<=CAN_TX_MOB+CAN_RX_MOBS; mob++)
+    {
+        CANPAGE = mob << 4;
+        if (CANSTMOB == 0) continue;
+
+        U8 next = (rxQueueHead + 1) & (CAN_RX_QUEUE-1);
+        if ((CANSTMOB & (1<<RXOK)) && next != rxQueueTail) // Otherwise drop it, as the link would miss an ack
+        {
+            CanFrame* frame = &rxQueue[rxQueueHead];
+            frame->length = CANCDMOB & 0x0F;
+            if (frame->length > 8) frame->length = 8;
+            for (U8 n=0; n<frame->length; n++) frame->data[n] = CANMSG;
+            frame->time = time;
+            rxQueueHead = next;
+        }
+        Can_EnableReceive(mob); // Rearm, which also clears the flags
+    }
+    CANPAGE = page;
+
+    PROFILE_EXIT(PROFILE_CAN_IT);
+}
+
+U8 Can_Receive(U8* data, U32* time)
+{
+    if (rxQueueTail == rxQueueHead) return 0;
+
+    CanFrame* frame = &rxQueue[rxQueueTail];
+    U8 length = frame->length;
+    for (U8 n=0; n<length; n++) data[n] = frame->data[n];
+    *time = frame->time;
+    rxQueueTail = (rxQueueTail + 1) & (CAN_RX_QUEUE-1);
+    return length;
+}
+
+bool Can_BusOk()
+{
+    return !(CANGSTA & ((1<<BOFF) | (1<<ERRP)));
+}
@@ -0,0 +1,19 @@
+// Can.h
+// Minimal AT90CAN CAN controller driver for the hexapod tether, one transmit message object and
+// a few receive ones emptied by interrupt into a queue
+// NOTE: TXCAN/RXCAN are PD5/PD6, which this board uses for the TFT CS and RS lines, so the tether needs a board
+// revision with those moved before CAN_TETHER (Link.h) can be enabled.
+
+#ifndef CAN_H
+#define CAN_H
+
+#include <stdbool.h>
+
+#include "compiler.h"
+
+void Can_Init(U32 receiveId);
+bool Can_Send(U32 id, const U8* data, U8 length); // False if the previous frame is still going out
+U8 Can_Receive(U8* data, U32* time); // Returns length of the oldest received frame, or 0 if none waiting
+bool Can_BusOk(); // False when error passive or bus off, e.g no tether plugged in
+
+#endif // CAN_H
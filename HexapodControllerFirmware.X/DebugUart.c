@@ -0,0 +1,50 @@
+// DebugUart.c
+// Polled USART0 for debug output, see DebugUart.h
+
+#include "DebugUart.h"
+
+#include <stdbool.h>
+#include <util/atomic.h>
+
+static bool sentSinceStart = false; // Transmit complete only means anything once something's gone out
+
+void DebugUart_Start(U8 ubrr, U8 enables)
+{
+    UBRR0H = 0;
+    UBRR0L = ubrr;
+    UCSR0C = (1<<UCSZ00) | (1<<UCSZ01); // 8 data, no parity, 1 stop bit, same as USART1
+    UCSR0B = enables;
+    sentSinceStart = false;
+}
+
+void DebugUart_Stop()
+{
+    UCSR0B = 0;
+}
+
+void DebugUart_Send(U8 c)
+{
+    while ((UCSR0A & (1<<UDRE0)) == 0);
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) // Clearing transmit complete late, after this byte has already gone, would hang the flush
+    {
+        UDR0 = c;
+        UCSR0A = (1<<TXC0); // Writing one clears it
+    }
+    sentSinceStart = true;
+}
+
+void DebugUart_SendBytes(const void* data, U8 length)
+{
+    for (const U8* p = data; length--; p++) DebugUart_Send(*p);
+}
+
+void DebugUart_SendText(const char* text)
+{
+    for (; *text; text++) DebugUart_Send(*text);
+}
+
+void DebugUart_Flush()
+{
+    if (!sentSinceStart) return;
+    while ((UCSR0A & (1<<TXC0)) == 0);
+}
@@ -0,0 +1,21 @@
+// DebugUart.h
+// USART0 on the programming header, shared by the trace dump, the benchmark log and the PC bridge
+// Only one of them has it at a time, each starting it at its own baud rate and stopping it when done.
+
+#ifndef DEBUGUART_H
+#define DEBUGUART_H
+
+#include <avr/io.h>
+
+#include "compiler.h"
+
+#define DEBUG_UART_LOG_UBRR 25 // 38400 baud for the trace dump and benchmark log, from AT90CAN32/64/128 manual, page 202
+
+void DebugUart_Start(U8 ubrr, U8 enables); // Enables are UCSR0B bits, e.g (1<<TXEN0) to only send
+void DebugUart_Stop(); // At once, dropping anything still going out
+void DebugUart_Send(U8 c); // Blocks until there's room, so only from the main loop
+void DebugUart_SendBytes(const void* data, U8 length);
+void DebugUart_SendText(const char* text);
+void DebugUart_Flush(); // Waits for the last byte from DebugUart_Send to leave, so stopping after doesn't cut it off
+
+#endif // DEBUGUART_H
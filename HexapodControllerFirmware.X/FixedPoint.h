@@ -0,0 +1,33 @@
+// FixedPoint.h
+// Division-free scaling helpers. The AVR has a hardware multiplier but no divider, so a 16-bit divide is a
+// ~200 cycle libgcc loop, whereas a 16x16->32 multiply by a precomputed reciprocal is ~20 cycles.
+
+#ifndef FIXEDPOINT_H
+#define FIXEDPOINT_H
+
+#include "compiler.h"
+
+// Reciprocal constants for scaling by num/den, rounded to nearest. Use with constant arguments so they fold at compile time.
+#define FP_Q16(num, den) ((U16)((((U32)(num) << 16) + (den)/2) / (den))) // Q0.16, for ratios below 1
+#define FP_Q8(num, den) ((U16)((((U32)(num) << 8) + (den)/2) / (den))) // Q8.8, for ratios up to 255
+
+// value*num/den, truncated, for a Q0.16 scale from FP_Q16
+static inline U16 FP_MulQ16(U16 value, U16 scale)
+{
+    return ((U32)value * scale) >> 16;
+}
+
+// Signed version, rounds towards zero like integer division does
+static inline S16 FP_MulQ16Signed(S16 value, U16 scale)
+{
+    if (value < 0) return -(S16)FP_MulQ16(-value, scale);
+    return FP_MulQ16(value, scale);
+}
+
+// value*num/den, rounded to nearest, for a Q8.8 scale from FP_Q8
+static inline U16 FP_MulQ8(U16 value, U16 scale)
+{
+    return ((U32)value * scale + 128) >> 8;
+}
+
+#endif // FIXEDPOINT_H
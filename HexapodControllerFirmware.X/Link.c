@@ -0,0 +1,268 @@
+// Link.c
+// Control link manager, see Link.h
+// Each control period the command goes out on the active link only, and a Ping on the standby link, each with a
+// fresh seq. The hexapod acks both on the link they arrived on. A link is unhealthy as soon as an ack is a period
+// late or its round trip is over LINK_MAX_RTT, and we switch before sending that period's command.
+
+#include "Link.h"
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#define __DELAY_BACKWARD_COMPATIBLE__
+#include <util/delay.h>
+
+#include "Bridge.h"
+#include "Can.h"
+#include "Params.h"
+#include "Profiler.h"
+#include "Telemetry.h"
+#include "Timebase.h"
+#include "Trace.h"
+
+LinkState links[NUM_LINKS];
+U8 activeLink = LINK_UART;
+
+static U8 seq = 0;
+static U8 rxBuffer[LINK_RX_BUFFER_SIZE];
+static volatile U8 rxHead = 0, rxTail = 0;
+static U8 rxFrame[PROTOCOL_MAX_LENGTH];
+static U8 rxLength = 0, rxReceived = 0;
+static U32 rxFrameTime; // When the frame being assembled started arriving
+static int receivedSoC;
+
+// Acks are timestamped as they arrive rather than when Link_Poll gets to them, as the main loop can spend longer
+// than LINK_MAX_RTT sending and drawing. The ISR follows the frame boundaries itself just to spot where acks start.
+typedef struct
+{
+    U8 position; // In rxBuffer, of the ack's first byte
+    U32 time;
+} AckArrival;
+
+static AckArrival ackArrivals[LINK_ACK_ARRIVALS];
+static volatile U8 ackHead = 0, ackTail = 0;
+static U8 isrFrameRemaining = 0;
+
+// Received bytes are buffered here, as one parameter query gets several frames back to back and the main loop can
+// be busy drawing for longer than the UART's two byte FIFO lasts
+ISR(USART1_RX_vect)
+{
+    PROFILE_ENTER(PROFILE_USART1_RX, LATENCY_NOT_MEASURED); // Nothing timestamps the byte's arrival, so only execution time is measured
+
+    U8 c = UDR1;
+    if (bridgeActive)
+    {
+        Bridge_FromRobot(c);
+        PROFILE_EXIT(PROFILE_USART1_RX);
+        return;
+    }
+
+    U8 next = (rxHead + 1) & (LINK_RX_BUFFER_SIZE-1);
+    if (next != rxTail) // Otherwise drop it, the frame's checksum will catch that
+    {
+        // Framed over the same bytes Link_Poll will see, so both agree where each frame starts
+        if (isrFrameRemaining)
+            isrFrameRemaining--;
+        else
+        {
+            U8 length = Protocol_FrameLength(c);
+            if (length) isrFrameRemaining = length - 1;
+            U8 nextAck = (ackHead + 1) & (LINK_ACK_ARRIVALS-1);
+            if (length && PROTOCOL_ID(c) == AckMsg_Id && nextAck != ackTail)
+            {
+                ackArrivals[ackHead].position = rxHead;
+                ackArrivals[ackHead].time = Timebase_Micros();
+                ackHead = nextAck;
+            }
+        }
+        rxBuffer[rxHead] = c;
+        rxHead = next;
+    }
+
+    PROFILE_EXIT(PROFILE_USART1_RX);
+}
+
+void Link_Init()
+{
+    links[LINK_UART].healthy = true; // Assume the radio works until shown otherwise
+    UCSR1B |= (1<<RXCIE1);
+#ifdef CAN_TETHER
+    Can_Init(HEXAPOD_TX_CAN_ID);
+#endif
+}
+
+void Transmit(unsigned char c)
+{
+    TRACE(TRACE_TRANSMIT_BEGIN, c);
+    while (( UCSR1A & (1<<UDRE1)) == 0); // Wait until TX buffer is empty (if needed)
+    UDR1 = c;// Putting data into buffer sends the data
+    while (( UCSR1A & (1<<UDRE1)) == 0);
+    _delay_ms(2); // Dirty hack, otherwise seems to be some bug with sending successive characters
+    TRACE(TRACE_TRANSMIT_END, c);
+}
+
+static void Link_SendFrame(U8 link, const U8* frame, U8 length)
+{
+    if (link == LINK_UART)
+    {
+        for (U8 n=0; n<length; n++) Transmit(frame[n]);
+        return;
+    }
+#ifdef CAN_TETHER
+    Can_Send(HEXAPOD_RX_CAN_ID, frame, length);
+#endif
+}
+
+static void Link_Sent(U8 link)
+{
+    links[link].sentSeq = seq;
+    links[link].sentTime = Timebase_Micros();
+    links[link].awaitingAck = true;
+    links[link].probed = true;
+}
+
+static void Link_UpdateHealth(U8 link)
+{
+    LinkState* state = &links[link];
+    if (!state->probed) return; // Nothing sent on it last period, so nothing to judge it by
+    state->probed = false;
+
+    bool good = !state->awaitingAck && state->rtt <= LINK_MAX_RTT; // Only an ack counts, silence never does
+    if (state->awaitingAck) // Nothing back within a whole period
+    {
+        state->awaitingAck = false;
+        if (state->missed < 255) state->missed++;
+    }
+#ifdef CAN_TETHER
+    if (link == LINK_CAN && !Can_BusOk()) good = false;
+#endif
+    if (!good)
+    {
+        state->healthy = false;
+        state->goodPeriods = 0;
+    }
+    else if (state->goodPeriods < LINK_RECOVERY_PERIODS && ++state->goodPeriods == LINK_RECOVERY_PERIODS)
+        state->healthy = true;
+}
+
+void Link_SendControl(ControlMsg* control)
+{
+#ifdef CAN_TETHER
+    for (U8 n=0; n<NUM_LINKS; n++) Link_UpdateHealth(n);
+
+    // Fail over as soon as the active link goes bad, and prefer the tether whenever it has proven healthy. A link
+    // is only healthy after LINK_RECOVERY_PERIODS acked probes, so we never switch to one that hasn't answered.
+    U8 standby = (activeLink == LINK_UART) ? LINK_CAN : LINK_UART;
+    if (links[standby].healthy && (!links[activeLink].healthy || standby == LINK_CAN))
+    {
+        standby = activeLink;
+        activeLink = (activeLink == LINK_UART) ? LINK_CAN : LINK_UART;
+    }
+#else
+    Link_UpdateHealth(LINK_UART); // No tether, so the radio is the only link and stays active even when failing
+#endif
+
+    U8 frame[PROTOCOL_MAX_LENGTH];
+    control->seq = ++seq;
+    Link_SendFrame(activeLink, frame, ControlMsg_Encode(frame, control));
+    Link_Sent(activeLink);
+
+#ifdef CAN_TETHER
+    PingMsg ping = { ++seq };
+    Link_SendFrame(standby, frame, PingMsg_Encode(frame, &ping));
+    Link_Sent(standby);
+#endif
+}
+
+void Link_Send(const U8* frame, U8 length)
+{
+    Link_SendFrame(activeLink, frame, length);
+}
+
+void Link_SendCommand(unsigned char c)
+{
+    Link_SendFrame(activeLink, &c, 1);
+}
+
+// Arrival time of the ack starting at this position in rxBuffer, or now if the ISR has none for it
+static U32 Link_AckArrival(U8 position)
+{
+    while (ackTail != ackHead)
+    {
+        AckArrival* arrival = &ackArrivals[ackTail];
+        if (arrival->position != position
+            && ((arrival->position - position) & (LINK_RX_BUFFER_SIZE-1)) < ((rxHead - position) & (LINK_RX_BUFFER_SIZE-1)))
+            break; // A later ack still in the buffer
+        ackTail = (ackTail + 1) & (LINK_ACK_ARRIVALS-1);
+        if (arrival->position == position) return arrival->time;
+    }
+    return Timebase_Micros();
+}
+
+static void Link_HandleFrame(U8 link, const U8* frame, U32 arrivalTime)
+{
+    switch (PROTOCOL_ID(frame[0]))
+    {
+        case AckMsg_Id:
+            break;
+        case TelemetryMsg_Id:
+            Telemetry_HandleFrame(frame);
+            return;
+        default:
+            Params_HandleFrame(frame);
+            return;
+    }
+
+    AckMsg ack;
+    if (!AckMsg_Decode(frame, &ack)) return;
+
+    LinkState* state = &links[link];
+    if (state->awaitingAck && ack.seq == state->sentSeq) // Late acks were already counted as missed
+    {
+        state->awaitingAck = false;
+        state->missed = 0;
+        U32 rtt = arrivalTime - state->sentTime;
+        state->rtt = rtt > 0xFFFF ? 0xFFFF : rtt;
+    }
+    receivedSoC = ack.stateOfCharge;
+}
+
+int Link_Poll()
+{
+    receivedSoC = -1;
+
+    while (rxTail != rxHead)
+    {
+        U8 position = rxTail;
+        U8 c = rxBuffer[rxTail];
+        rxTail = (rxTail + 1) & (LINK_RX_BUFFER_SIZE-1);
+        if (rxLength == 0) // Between frames
+        {
+            rxLength = Protocol_FrameLength(c);
+            if (rxLength == 0)
+            {
+                receivedSoC = c; // Older hexapod firmware just sends its SoC as a raw byte
+                continue;
+            }
+            rxReceived = 0;
+            if (PROTOCOL_ID(c) == AckMsg_Id) rxFrameTime = Link_AckArrival(position);
+        }
+        rxFrame[rxReceived++] = c;
+        if (rxReceived == rxLength)
+        {
+            Link_HandleFrame(LINK_UART, rxFrame, rxFrameTime);
+            rxLength = 0;
+        }
+    }
+
+#ifdef CAN_TETHER
+    U8 data[8];
+    U32 time;
+    U8 length;
+    while ((length = Can_Receive(data, &time)) > 0) // A parameter query alone gets several replies at once
+    {
+        if (Protocol_FrameLength(data[0]) == length) Link_HandleFrame(LINK_CAN, data, time);
+    }
+#endif
+
+    return receivedSoC;
+}
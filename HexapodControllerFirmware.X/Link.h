@@ -0,0 +1,47 @@
+// Link.h
+// Control link manager: runs control over the UART radio, and over a CAN tether when one is connected,
+// watching both for missed acks and round trip time and failing over within one control period
+
+#ifndef LINK_H
+#define LINK_H
+
+#include <stdbool.h>
+
+#include "compiler.h"
+#include "Protocol.h"
+
+//#define CAN_TETHER // Needs a board revision with the TFT off PD5/PD6, see Can.h
+
+#define HEXAPOD_RX_CAN_ID   0x18FFED10 // i.e we send, hexapod receives
+#define HEXAPOD_TX_CAN_ID   0x18FFED00 // hexapod sends, we receive
+
+#define LINK_MAX_RTT            50000 // Microseconds
+#define LINK_RECOVERY_PERIODS   5 // Consecutive good periods before a link that failed is trusted again
+#define LINK_RX_BUFFER_SIZE     64 // UART receive ring buffer, must be a power of 2
+#define LINK_ACK_ARRIVALS       4 // Ack timestamps queued by the UART receive ISR, must be a power of 2
+
+enum Links { LINK_UART, LINK_CAN, NUM_LINKS };
+
+typedef struct
+{
+    U8 sentSeq;
+    bool awaitingAck; // Cleared when sentSeq is acked, if still set a period later the ack is counted as missed
+    bool probed; // Something was sent on it since the last health update
+    U32 sentTime; // Timebase_Micros
+    U16 rtt; // Microseconds, saturating
+    U8 missed; // Consecutive missed acks
+    U8 goodPeriods;
+    bool healthy;
+} LinkState;
+
+extern LinkState links[NUM_LINKS];
+extern U8 activeLink;
+
+void Link_Init();
+void Link_SendControl(ControlMsg* control); // Once per control period, fills in seq and picks the link
+void Link_Send(const U8* frame, U8 length); // Encoded frame on the active link, e.g parameter traffic
+void Link_SendCommand(unsigned char c); // Legacy single character command (e.g eye colour) on the active link
+int Link_Poll(); // Handles received bytes and frames, returns the hexapod's latest SoC or -1 if none arrived
+void Transmit(unsigned char c); // Raw UART byte to the hexapod radio
+
+#endif // LINK_H
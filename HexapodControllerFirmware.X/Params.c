@@ -0,0 +1,255 @@
+// Params.c
+// Parameter server sync, see Params.h
+// Offline -> Querying (ParamQuery for the table) -> Fetching (one ParamQuery per entry) or straight to Synced when
+// the hash matches our cache. Once synced, edits set a dirty bit and go out in ParamValues frames, two per frame.
+// Any unhealthy period on the active link drops us back to offline, so a reconnect always re-checks the hash.
+
+#include "Params.h"
+
+#include <string.h>
+#include <avr/eeprom.h>
+
+#include "Protocol.h"
+#include "Link.h"
+
+#define PARAM_CACHE_VALID 0xA5
+
+// Parts of an entry received while fetching
+#define RECEIVED_RANGE  0b0001
+#define RECEIVED_NAME0  0b0010
+#define RECEIVED_NAME1  0b0100
+#define RECEIVED_VALUE  0b1000
+#define RECEIVED_ALL    0b1111
+
+ParamCache paramCache;
+ParamCache EEMEM paramCacheEeprom;
+U8 paramSyncState = PARAMS_OFFLINE;
+U8 paramsFetched = 0;
+
+static U16 paramsDirty = 0;
+static bool paramsEdited = false; // Values differ from EEPROM
+static U16 saveRemaining = 0; // Bytes of the cache Params_SaveStep has still to check against EEPROM
+static U8 received[MAX_PARAMS];
+static U8 retryTimer = 0;
+
+void Params_Init()
+{
+    eeprom_read_block(&paramCache, &paramCacheEeprom, sizeof(paramCache));
+    if (paramCache.valid != PARAM_CACHE_VALID || paramCache.count > MAX_PARAMS) // Blank or from older firmware
+        memset(&paramCache, 0, sizeof(paramCache));
+}
+
+static void Params_SendQuery(U8 index)
+{
+    U8 frame[PROTOCOL_MAX_LENGTH];
+    ParamQueryMsg query = { index };
+    Link_Send(frame, ParamQueryMsg_Encode(frame, &query));
+    retryTimer = PARAM_RETRY_PERIODS;
+}
+
+// Takes the lowest dirty entry, or PARAM_NONE if there are none
+static U8 Params_NextDirty()
+{
+    for (U8 n=0; n<paramCache.count; n++)
+    {
+        U16 bit = 1U<<n;
+        if (paramsDirty & bit)
+        {
+            paramsDirty &= ~bit;
+            return n;
+        }
+    }
+    return PARAM_NONE;
+}
+
+static void Params_SendDirty()
+{
+    U8 frame[PROTOCOL_MAX_LENGTH];
+    for (U8 n=0; n<PARAM_FRAMES_PER_PERIOD && paramsDirty; n++)
+    {
+        ParamValuesMsg values;
+        values.index0 = Params_NextDirty();
+        values.value0 = paramCache.params[values.index0].value;
+        values.index1 = Params_NextDirty();
+        values.value1 = values.index1 == PARAM_NONE ? 0 : paramCache.params[values.index1].value;
+        Link_Send(frame, ParamValuesMsg_Encode(frame, &values));
+    }
+}
+
+void Params_Update()
+{
+    if (!links[activeLink].healthy)
+    {
+        paramSyncState = PARAMS_OFFLINE;
+        return;
+    }
+
+    switch (paramSyncState)
+    {
+        case PARAMS_OFFLINE:
+            paramSyncState = PARAMS_QUERYING;
+            Params_SendQuery(PARAM_TABLE_INDEX);
+            break;
+
+        case PARAMS_QUERYING:
+            if (--retryTimer == 0) Params_SendQuery(PARAM_TABLE_INDEX);
+            break;
+
+        case PARAMS_FETCHING:
+            if (paramsFetched == paramCache.count)
+            {
+                paramCache.valid = PARAM_CACHE_VALID;
+                paramsEdited = true;
+                Params_Save();
+                paramSyncState = PARAMS_SYNCED;
+                break;
+            }
+            if (retryTimer == 0 || --retryTimer == 0) // Zeroed by Params_HandleFrame when an entry completes
+            {
+                U8 index = 0;
+                while (received[index] == RECEIVED_ALL) index++;
+                Params_SendQuery(index);
+            }
+            break;
+
+        case PARAMS_SYNCED:
+            Params_SendDirty();
+            break;
+    }
+}
+
+static void Params_Received(U8 index, U8 part)
+{
+    if (paramSyncState != PARAMS_FETCHING || received[index] == RECEIVED_ALL) return;
+    received[index] |= part;
+    if (received[index] == RECEIVED_ALL)
+    {
+        paramsFetched++;
+        retryTimer = 0; // Ask for the next one straight away
+    }
+}
+
+static void Params_HandleTable(ParamTableMsg* table)
+{
+    if (paramSyncState != PARAMS_QUERYING) return;
+
+    U8 count = table->count > MAX_PARAMS ? MAX_PARAMS : table->count; // As it was cached, so a long table can still match
+    if (paramCache.valid == PARAM_CACHE_VALID && count == paramCache.count && table->hash == paramCache.hash)
+    {
+        // Same table as last time, so the hexapod only needs our values
+        paramsDirty = (1UL<<paramCache.count) - 1;
+        paramSyncState = PARAMS_SYNCED;
+        return;
+    }
+
+    memset(&paramCache, 0, sizeof(paramCache));
+    memset(received, 0, sizeof(received));
+    paramCache.count = count;
+    paramCache.hash = table->hash;
+    paramsFetched = 0;
+    paramsDirty = 0;
+    retryTimer = 0;
+    paramSyncState = PARAMS_FETCHING;
+}
+
+static void Params_HandleValue(U8 index, U16 value)
+{
+    if (index >= paramCache.count || (paramsDirty & (1U<<index))) return; // Our unsent edit wins
+    paramCache.params[index].value = value;
+    Params_Received(index, RECEIVED_VALUE);
+}
+
+void Params_HandleFrame(const U8* frame)
+{
+    switch (PROTOCOL_ID(frame[0]))
+    {
+        case ParamTableMsg_Id:
+        {
+            ParamTableMsg table;
+            if (ParamTableMsg_Decode(frame, &table)) Params_HandleTable(&table);
+            break;
+        }
+        case ParamRangeMsg_Id:
+        {
+            ParamRangeMsg range;
+            if (!ParamRangeMsg_Decode(frame, &range) || range.index >= paramCache.count) break;
+            paramCache.params[range.index].min = range.min;
+            paramCache.params[range.index].max = range.max;
+            Params_Received(range.index, RECEIVED_RANGE);
+            break;
+        }
+        case ParamNameMsg_Id:
+        {
+            ParamNameMsg name;
+            if (!ParamNameMsg_Decode(frame, &name) || name.index >= paramCache.count) break;
+            char* chars = &paramCache.params[name.index].name[name.part*6];
+            chars[0] = name.c0;
+            chars[1] = name.c1;
+            chars[2] = name.c2;
+            chars[3] = name.c3;
+            chars[4] = name.c4;
+            chars[5] = name.c5;
+            Params_Received(name.index, name.part ? RECEIVED_NAME1 : RECEIVED_NAME0);
+            break;
+        }
+        case ParamValuesMsg_Id:
+        {
+            ParamValuesMsg values;
+            if (!ParamValuesMsg_Decode(frame, &values)) break;
+            Params_HandleValue(values.index0, values.value0);
+            Params_HandleValue(values.index1, values.value1);
+            break;
+        }
+    }
+}
+
+void Params_Set(U8 index, S16 value)
+{
+    // Until synced an entry may lack its range, and an edit would make Params_HandleValue drop the value being fetched
+    if (paramSyncState != PARAMS_SYNCED) return;
+    Param* param = &paramCache.params[index];
+    if (value < param->min) value = param->min;
+    if (value > param->max) value = param->max;
+    if (value == param->value) return;
+    param->value = value;
+    paramsDirty |= 1U<<index;
+    paramsEdited = true;
+}
+
+// Percentages are only for the settings sliders, so the divisions here are fine
+U8 Params_GetPercent(U8 index)
+{
+    Param* param = &paramCache.params[index];
+    if (param->max <= param->min) return 0;
+    return ((S32)param->value - param->min)*100 / ((S32)param->max - param->min);
+}
+
+void Params_SetPercent(U8 index, U8 percent)
+{
+    Param* param = &paramCache.params[index];
+    Params_Set(index, param->min + ((S32)param->max - param->min)*percent/100);
+}
+
+void Params_Save()
+{
+    if (!paramsEdited) return;
+    paramsEdited = false;
+    saveRemaining = sizeof(paramCache); // Restarts a save in progress, which picks up anything it already passed
+}
+
+// Works from the end of the cache back, so the hash and valid flag go last and a save cut short by power off leaves
+// a hash that no longer matches, and the table is fetched again
+void Params_SaveStep()
+{
+    while (saveRemaining && eeprom_is_ready())
+    {
+        saveRemaining--;
+        U8 value = ((U8*)&paramCache)[saveRemaining];
+        U8* address = (U8*)&paramCacheEeprom + saveRemaining;
+        if (eeprom_read_byte(address) != value)
+        {
+            eeprom_write_byte(address, value); // Returns once started, the write then takes about 3.3ms
+            return;
+        }
+    }
+}
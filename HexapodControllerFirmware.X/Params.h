@@ -0,0 +1,47 @@
+// Params.h
+// Controller side of the hexapod parameter server, see the Param messages in ProtocolSchema.h
+// The table (names, ranges and values) is cached in RAM and EEPROM along with the hexapod's hash of it, so on
+// reconnect a matching hash skips the fetch and we just push our values back down
+
+#ifndef PARAMS_H
+#define PARAMS_H
+
+#include <stdbool.h>
+
+#include "compiler.h"
+
+#define MAX_PARAMS              16 // Dirty and fetched flags are U16 bitmasks
+#define PARAM_NAME_LENGTH       12 // Two ParamName parts of 6 characters
+#define PARAM_RETRY_PERIODS     3 // Control periods to wait for a reply before asking again
+#define PARAM_FRAMES_PER_PERIOD 2 // ParamValues frames pushed per control period, i.e up to 4 values
+
+enum ParamSyncStates { PARAMS_OFFLINE, PARAMS_QUERYING, PARAMS_FETCHING, PARAMS_SYNCED };
+
+typedef struct
+{
+    S16 value, min, max;
+    char name[PARAM_NAME_LENGTH+1];
+} Param;
+
+typedef struct
+{
+    U8 valid; // PARAM_CACHE_VALID once every entry has been fetched
+    U8 count;
+    U16 hash;
+    Param params[MAX_PARAMS];
+} ParamCache;
+
+extern ParamCache paramCache;
+extern U8 paramSyncState;
+extern U8 paramsFetched; // Entries complete so far while PARAMS_FETCHING
+
+void Params_Init(); // Loads the cache from EEPROM
+void Params_Update(); // Once per control period, after Link_SendControl
+void Params_HandleFrame(const U8* frame);
+void Params_Set(U8 index, S16 value); // Clamps to the entry's range and queues it to be sent, ignored until synced
+U8 Params_GetPercent(U8 index);
+void Params_SetPercent(U8 index, U8 percent);
+void Params_Save(); // Queues edited values to be written back to EEPROM by Params_SaveStep
+void Params_SaveStep(); // Once per main loop pass, writes at most one changed byte and never waits for the EEPROM
+
+#endif // PARAMS_H
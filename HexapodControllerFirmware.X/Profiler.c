@@ -0,0 +1,30 @@
+// Profiler.c
+// ISR execution time and interrupt latency profiling
+
+#include "Profiler.h"
+
+#ifdef ISR_PROFILING
+
+#include <string.h>
+#include <util/atomic.h>
+
+IsrProfile isrProfiles[NUM_PROFILED_ISRS];
+
+void Profiler_Reset()
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        memset(isrProfiles, 0, sizeof(isrProfiles));
+    }
+}
+
+void Profiler_Snapshot(U8 isr, IsrProfile* copy)
+{
+    // ISRs update the 32-bit fields, so copy with interrupts off to avoid torn reads
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        *copy = isrProfiles[isr];
+    }
+}
+
+#endif
@@ -0,0 +1,86 @@
+// Profiler.h
+// ISR execution time and interrupt latency profiling
+// Timings are raw counts of Timer3, the timebase hardware counter (see Timebase.h), so 0.5us each and cheap to read
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdbool.h>
+#include <avr/io.h>
+
+#include "compiler.h"
+#include "Trace.h"
+
+//#define ISR_PROFILING // Adds about 10% CPU load, mostly in the Timer0 backlight ISRs, so only for profiling builds
+
+enum ProfiledIsrs {
+    PROFILE_TIMER0_OVF,
+    PROFILE_TIMER0_COMP,
+    PROFILE_TIMER1_OVF,
+    PROFILE_USART1_RX,
+    PROFILE_SPI_STC, // Only runs with TOUCH_HW_SPI
+    PROFILE_USART0_RX, // Bridge mode only
+    PROFILE_USART0_UDRE,
+    PROFILE_USART1_UDRE,
+    PROFILE_TIMER3_OVF,
+    PROFILE_CAN_IT, // Only runs with CAN_TETHER
+    NUM_PROFILED_ISRS
+};
+
+// Latency histogram buckets in whole microseconds: 0, 1, 2-3, 4-7 and so on doubling, with the last one open ended
+#define LATENCY_BUCKETS 8
+#define LATENCY_NOT_MEASURED 0xFFFF // From ISRs with nothing to time their interrupt condition by, leaves latency out
+
+typedef struct
+{
+    U32 count;
+    U32 totalTime; // For the mean, sum of all execution times
+    U16 maxTime;
+    U16 maxLatency; // Time from the interrupt condition to the first instruction of our handler
+    U16 latencyHistogram[LATENCY_BUCKETS]; // Saturating counts
+} IsrProfile;
+
+#ifdef ISR_PROFILING
+
+extern IsrProfile isrProfiles[NUM_PROFILED_ISRS];
+
+void Profiler_Reset();
+void Profiler_Snapshot(U8 isr, IsrProfile* copy);
+
+// Inlined rather than called, as calling a function from an ISR makes it push every call-used register
+static inline void Profiler_Exit(U8 isr, U16 startTime, U16 latency)
+{
+    IsrProfile* profile = &isrProfiles[isr];
+    U16 time = TCNT3 - startTime;
+    profile->count++;
+    profile->totalTime += time;
+    if (time > profile->maxTime) profile->maxTime = time;
+    if (latency == LATENCY_NOT_MEASURED) return;
+    if (latency > profile->maxLatency) profile->maxLatency = latency;
+
+    U8 bucket = 0;
+    for (U16 micros = latency>>1; micros && bucket < LATENCY_BUCKETS-1; micros >>= 1) bucket++;
+    if (profile->latencyHistogram[bucket] != 0xFFFF) profile->latencyHistogram[bucket]++;
+}
+
+// False until an ISR records some latency, so the pages can tell one with none measured from one that's just fast
+static inline bool Profiler_LatencyMeasured(const IsrProfile* profile)
+{
+    for (U8 n=0; n<LATENCY_BUCKETS; n++)
+        if (profile->latencyHistogram[n]) return true;
+    return false;
+}
+
+// Latency is passed in by each ISR, as only it knows when its interrupt condition occurred (usually its own timer count)
+#define PROFILE_ENTER(isr, latency) U16 profileStart = TCNT3; U16 profileLatency = (latency); TRACE_ISR(TRACE_ISR_BEGIN, isr)
+#define PROFILE_EXIT(isr) Profiler_Exit(isr, profileStart, profileLatency); TRACE_ISR(TRACE_ISR_END, isr)
+
+#else
+
+// Still marks the ISRs on the trace timeline when only tracing is enabled
+#define PROFILE_ENTER(isr, latency) TRACE_ISR(TRACE_ISR_BEGIN, isr)
+#define PROFILE_EXIT(isr) TRACE_ISR(TRACE_ISR_END, isr)
+
+#endif
+
+#endif // PROFILER_H
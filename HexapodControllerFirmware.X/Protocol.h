@@ -0,0 +1,129 @@
+// Protocol.h
+// Message packing and unpacking generated from ProtocolSchema.h
+// Plain C with stdint types only, so it builds unchanged for AVR or Linux
+//
+// For each MESSAGE(Name, ...) in the schema this defines:
+//   NameMsg                   struct with one member per field
+//   NameMsg_Id                message id, as returned by PROTOCOL_ID(first byte)
+//   NameMsg_Length            frame length in bytes including the checksum
+//   NameMsg_Encode(frame, msg)  packs msg into frame, returns the length
+//   NameMsg_Decode(frame, msg)  unpacks frame into msg, returns 0 if the type or checksum is wrong
+// Each encoder and decoder is straight line code for its own field list, nothing interprets the schema at runtime.
+
+#ifndef PROTOCOL_H
+#define PROTOCOL_H
+
+#include <stdint.h>
+
+#include "ProtocolSchema.h"
+
+#define PROTOCOL_TYPE_BITS 3
+#define PROTOCOL_FRAME_FLAG 0x80 // Set in the first byte of every frame
+#define PROTOCOL_TYPE(header) ((header) >> (8 - PROTOCOL_TYPE_BITS))
+#define PROTOCOL_EXTENDED 0x7 // Type whose first byte is a full 8-bit id
+
+// Ids 0x4-0x6 are 3-bit types, leaving the rest of the first byte for fields, extended ids 0xE0-0xFF take the whole byte
+#define PROTOCOL_ID(header) (PROTOCOL_TYPE(header) == PROTOCOL_EXTENDED ? (header) : PROTOCOL_TYPE(header))
+#define PROTOCOL_ID_BITS(id) ((id) > PROTOCOL_EXTENDED ? 8 : PROTOCOL_TYPE_BITS)
+
+typedef struct
+{
+    uint8_t* out;
+    uint32_t accumulator;
+    uint8_t pendingBits;
+} ProtoPacker;
+
+typedef struct
+{
+    const uint8_t* in;
+    uint32_t accumulator;
+    uint8_t pendingBits;
+} ProtoUnpacker;
+
+static inline void Proto_Pack(ProtoPacker* packer, uint16_t value, uint8_t bits)
+{
+    // Shift into the accumulator and peel whole bytes off the top
+    packer->accumulator = (packer->accumulator << bits) | (value & ((1UL << bits) - 1));
+    packer->pendingBits += bits;
+    while (packer->pendingBits >= 8)
+    {
+        packer->pendingBits -= 8;
+        *packer->out++ = packer->accumulator >> packer->pendingBits;
+    }
+}
+
+static inline uint8_t Proto_Finish(ProtoPacker* packer, uint8_t* frame)
+{
+    if (packer->pendingBits > 0) Proto_Pack(packer, 0, 8 - packer->pendingBits); // Pad last byte with zeros
+
+    uint8_t checksum = 0;
+    for (uint8_t* p = frame; p < packer->out; p++) checksum += *p;
+    *packer->out++ = checksum;
+    return packer->out - frame;
+}
+
+static inline uint16_t Proto_Unpack(ProtoUnpacker* unpacker, uint8_t bits)
+{
+    while (unpacker->pendingBits < bits)
+    {
+        unpacker->accumulator = (unpacker->accumulator << 8) | *unpacker->in++;
+        unpacker->pendingBits += 8;
+    }
+    unpacker->pendingBits -= bits;
+    return (unpacker->accumulator >> unpacker->pendingBits) & ((1UL << bits) - 1);
+}
+
+static inline uint8_t Proto_ChecksumOk(const uint8_t* frame, uint8_t length)
+{
+    uint8_t checksum = 0;
+    for (uint8_t n=0; n<length-1; n++) checksum += frame[n];
+    return checksum == frame[length-1];
+}
+
+#define PROTO_STRUCT_FIELD(ctype, name, bits) ctype name;
+#define PROTO_COUNT_BITS(ctype, name, bits) + (bits)
+#define PROTO_PACK_FIELD(ctype, name, bits) Proto_Pack(&packer, msg->name, bits);
+#define PROTO_UNPACK_FIELD(ctype, name, bits) msg->name = Proto_Unpack(&unpacker, bits);
+
+#define PROTO_DEFINE_MESSAGE(Name, id, FIELDS) \
+    typedef struct { FIELDS(PROTO_STRUCT_FIELD) } Name##Msg; \
+    enum { \
+        Name##Msg_Id = (id), \
+        Name##Msg_Length = (PROTOCOL_ID_BITS(id) FIELDS(PROTO_COUNT_BITS) + 7)/8 + 1 \
+    }; \
+    static inline uint8_t Name##Msg_Encode(uint8_t* frame, const Name##Msg* msg) \
+    { \
+        ProtoPacker packer = { frame, 0, 0 }; \
+        Proto_Pack(&packer, (id), PROTOCOL_ID_BITS(id)); \
+        FIELDS(PROTO_PACK_FIELD) \
+        return Proto_Finish(&packer, frame); \
+    } \
+    static inline uint8_t Name##Msg_Decode(const uint8_t* frame, Name##Msg* msg) \
+    { \
+        if (PROTOCOL_ID(frame[0]) != (id) || !Proto_ChecksumOk(frame, Name##Msg_Length)) return 0; \
+        ProtoUnpacker unpacker = { frame, 0, 0 }; \
+        Proto_Unpack(&unpacker, PROTOCOL_ID_BITS(id)); \
+        FIELDS(PROTO_UNPACK_FIELD) \
+        return 1; \
+    }
+
+PROTOCOL_MESSAGES(PROTO_DEFINE_MESSAGE)
+
+#define PROTO_LENGTH_CASE(Name, id, FIELDS) case (id): return Name##Msg_Length;
+#define PROTO_MAX_LENGTH(Name, id, FIELDS) uint8_t Name[Name##Msg_Length];
+
+// Frame length implied by a first byte, so a receiver knows how many more bytes to wait for (0 if not a frame)
+static inline uint8_t Protocol_FrameLength(uint8_t header)
+{
+    if (!(header & PROTOCOL_FRAME_FLAG)) return 0;
+    switch (PROTOCOL_ID(header))
+    {
+        PROTOCOL_MESSAGES(PROTO_LENGTH_CASE)
+    }
+    return 0;
+}
+
+// Big enough for any message in the schema
+#define PROTOCOL_MAX_LENGTH sizeof(union { PROTOCOL_MESSAGES(PROTO_MAX_LENGTH) })
+
+#endif // PROTOCOL_H
@@ -0,0 +1,107 @@
+// ProtocolSchema.h
+// The single definition of the controller <-> hexapod wire protocol
+// Protocol.h expands this into message structs plus encode and decode functions, so the controller
+// firmware, the hexapod firmware and PC tools all build their packers from this one file.
+//
+// MESSAGE(name, id, FIELDS) gives the message id. Ids 0x4-0x6 are 3-bit types packed into the top of the first
+// byte, for messages that need every bit. Ids 0xE0-0xFF are extended ids that fill the first byte. Either way the
+// first byte has bit 7 set, so frames can't be confused with the legacy single character commands or SoC bytes.
+// FIELD(ctype, name, bits) entries then follow MSB first, up to 16 bits each, and a byte-sum checksum ends the frame.
+//
+// Every frame has to fit in one 8-byte CAN payload, since control can also run over the CAN tether.
+// To change the protocol, edit the lists below and rebuild every side - there are no hand written parsers to update.
+
+#ifndef PROTOCOLSCHEMA_H
+#define PROTOCOLSCHEMA_H
+
+#define PROTOCOL_MESSAGES(MESSAGE) \
+    MESSAGE(Control,   0x4,  CONTROL_FIELDS) \
+    MESSAGE(Ack,       0x5,  ACK_FIELDS) \
+    MESSAGE(Control12, 0x6,  CONTROL12_FIELDS) \
+    MESSAGE(Ping,      0xE0, PING_FIELDS) \
+    MESSAGE(ParamQuery,  0xE1, PARAM_QUERY_FIELDS) \
+    MESSAGE(ParamTable,  0xE2, PARAM_TABLE_FIELDS) \
+    MESSAGE(ParamRange,  0xE3, PARAM_RANGE_FIELDS) \
+    MESSAGE(ParamName,   0xE4, PARAM_NAME_FIELDS) \
+    MESSAGE(ParamValues, 0xE5, PARAM_VALUES_FIELDS) \
+    MESSAGE(Telemetry,   0xE6, TELEMETRY_FIELDS)
+
+// Joystick command, 10-bit axes to match the ADC, 8 bytes on the wire
+// seq increments with every Control or Ping sent, on whichever link. The hexapod must ignore a Control whose seq
+// isn't newer than the last one it acted on ((int8_t)(seq - last) <= 0), which drops stragglers from the old link
+// after a failover. The controller never resends a seq, so nothing is duplicated.
+#define CONTROL_FIELDS(FIELD) \
+    FIELD(uint8_t,  controlBits, 5) \
+    FIELD(uint16_t, leftX,  10) \
+    FIELD(uint16_t, leftY,  10) \
+    FIELD(uint16_t, rightX, 10) \
+    FIELD(uint16_t, rightY, 10) \
+    FIELD(uint8_t,  seq, 8)
+
+// Same with 12-bit axes for higher resolution inputs, 9 bytes on the wire so UART only
+#define CONTROL12_FIELDS(FIELD) \
+    FIELD(uint8_t,  controlBits, 5) \
+    FIELD(uint16_t, leftX,  12) \
+    FIELD(uint16_t, leftY,  12) \
+    FIELD(uint16_t, rightX, 12) \
+    FIELD(uint16_t, rightY, 12) \
+    FIELD(uint8_t,  seq, 8)
+
+// Hexapod to controller, sent back on the same link for every Control or Ping received
+#define ACK_FIELDS(FIELD) \
+    FIELD(uint8_t, seq, 8) \
+    FIELD(uint8_t, stateOfCharge, 7)
+
+// Link health probe, sent on the standby link each control period so its health is known before we need it
+#define PING_FIELDS(FIELD) \
+    FIELD(uint8_t, seq, 8)
+
+// Parameter server. The hexapod owns a table of named, ranged gait parameters. The controller asks for the table's
+// count and hash, and only fetches the entries (range, name and value) when the hash differs from its cached copy.
+// After that the controller is the source of truth for values and pushes just the edited ones in ParamValues batches.
+#define PARAM_TABLE_INDEX 0xFF // In ParamQuery, asks for ParamTable rather than an entry
+#define PARAM_NONE 0xFF // In ParamValues, marks an unused slot
+
+// Controller to hexapod, answered with ParamTable or with ParamRange, both ParamName parts and ParamValues for one entry
+#define PARAM_QUERY_FIELDS(FIELD) \
+    FIELD(uint8_t, index, 8)
+
+// Hash covers the count, ranges and names (not values), so it changes whenever the hexapod's table layout does
+#define PARAM_TABLE_FIELDS(FIELD) \
+    FIELD(uint8_t,  count, 8) \
+    FIELD(uint16_t, hash, 16)
+
+#define PARAM_RANGE_FIELDS(FIELD) \
+    FIELD(uint8_t,  index, 8) \
+    FIELD(uint16_t, min, 16) \
+    FIELD(uint16_t, max, 16)
+
+// Names are up to 12 ASCII characters, sent in two parts of 6 and zero padded
+#define PARAM_NAME_FIELDS(FIELD) \
+    FIELD(uint8_t, index, 5) \
+    FIELD(uint8_t, part, 1) \
+    FIELD(uint8_t, c0, 7) \
+    FIELD(uint8_t, c1, 7) \
+    FIELD(uint8_t, c2, 7) \
+    FIELD(uint8_t, c3, 7) \
+    FIELD(uint8_t, c4, 7) \
+    FIELD(uint8_t, c5, 7)
+
+// Either direction, two entries per frame. Values are int16_t sent as their 16-bit pattern.
+#define PARAM_VALUES_FIELDS(FIELD) \
+    FIELD(uint8_t,  index0, 8) \
+    FIELD(uint16_t, value0, 16) \
+    FIELD(uint8_t,  index1, 8) \
+    FIELD(uint16_t, value1, 16)
+
+// Hexapod to controller, streamed as fast as it likes, two samples per frame. Channels are listed in Telemetry.h
+// and values are int16_t in that channel's units, sent as their 16-bit pattern.
+#define TELEMETRY_NONE 0xFF // Marks an unused slot
+
+#define TELEMETRY_FIELDS(FIELD) \
+    FIELD(uint8_t,  channel0, 8) \
+    FIELD(uint16_t, value0, 16) \
+    FIELD(uint8_t,  channel1, 8) \
+    FIELD(uint16_t, value1, 16)
+
+#endif // PROTOCOLSCHEMA_H
@@ -0,0 +1,70 @@
+// Telemetry.c
+// Telemetry aggregation, see Telemetry.h
+// Frames are decoded from Link_Poll in the main loop, the same as Telemetry_EndInterval, so nothing here needs
+// protecting from interrupts.
+
+#include "Telemetry.h"
+
+#include <string.h>
+
+#include "Protocol.h"
+
+typedef struct
+{
+    S16 min, max;
+    S32 sum;
+    U16 count;
+} TelemetryAccumulator;
+
+TelemetryStats telemetryLatest[NUM_TELEMETRY_CHANNELS];
+TelemetryStats telemetryHistory[TELEMETRY_HISTORY];
+U8 telemetryHistoryHead = 0;
+U8 telemetryChartChannel = TELEMETRY_BATTERY;
+
+static TelemetryAccumulator accumulators[NUM_TELEMETRY_CHANNELS];
+
+static void Telemetry_AddSample(U8 channel, S16 value)
+{
+    if (channel >= NUM_TELEMETRY_CHANNELS) return; // Also skips TELEMETRY_NONE
+    TelemetryAccumulator* acc = &accumulators[channel];
+    if (acc->count == 0xFFFF) return; // Can't happen at any real link speed, but the sum must not overflow
+    if (acc->count == 0 || value < acc->min) acc->min = value;
+    if (acc->count == 0 || value > acc->max) acc->max = value;
+    acc->sum += value;
+    acc->count++;
+}
+
+void Telemetry_HandleFrame(const U8* frame)
+{
+    TelemetryMsg telemetry;
+    if (!TelemetryMsg_Decode(frame, &telemetry)) return;
+    Telemetry_AddSample(telemetry.channel0, telemetry.value0);
+    Telemetry_AddSample(telemetry.channel1, telemetry.value1);
+}
+
+void Telemetry_EndInterval()
+{
+    for (U8 n=0; n<NUM_TELEMETRY_CHANNELS; n++)
+    {
+        TelemetryAccumulator* acc = &accumulators[n];
+        TelemetryStats* stats = &telemetryLatest[n];
+        stats->count = acc->count;
+        if (acc->count)
+        {
+            stats->min = acc->min;
+            stats->max = acc->max;
+            stats->mean = acc->sum / acc->count;
+        }
+        acc->count = 0;
+        acc->sum = 0;
+    }
+
+    telemetryHistory[telemetryHistoryHead] = telemetryLatest[telemetryChartChannel];
+    telemetryHistoryHead = (telemetryHistoryHead + 1) % TELEMETRY_HISTORY;
+}
+
+void Telemetry_SetChartChannel(U8 channel)
+{
+    telemetryChartChannel = channel;
+    memset(telemetryHistory, 0, sizeof(telemetryHistory));
+}
@@ -0,0 +1,41 @@
+// Telemetry.h
+// Decimates the hexapod's telemetry stream down to display rate
+// Each sample costs the same few operations however fast they arrive: it only updates its channel's running min,
+// max and sum. Telemetry_EndInterval then closes those into min/max/mean for the interval, so a spike shorter than
+// one display refresh still shows up in the readouts and as the height of the chart's bars.
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include "compiler.h"
+
+#define TELEMETRY_HISTORY 40 // Intervals kept for the chart, i.e 20 seconds at 2Hz
+
+enum TelemetryChannels {
+    TELEMETRY_BATTERY, // mV
+    TELEMETRY_CURRENT, // mA, whole robot
+    TELEMETRY_LEG_1, // mA, each leg's servos
+    TELEMETRY_LEG_2,
+    TELEMETRY_LEG_3,
+    TELEMETRY_LEG_4,
+    TELEMETRY_LEG_5,
+    TELEMETRY_LEG_6,
+    NUM_TELEMETRY_CHANNELS
+};
+
+typedef struct
+{
+    S16 min, max, mean;
+    U16 count; // Samples in the interval, 0 when none arrived and the rest is meaningless
+} TelemetryStats;
+
+extern TelemetryStats telemetryLatest[NUM_TELEMETRY_CHANNELS]; // Last completed interval of every channel
+extern TelemetryStats telemetryHistory[TELEMETRY_HISTORY]; // Chart channel only, oldest at telemetryHistoryHead
+extern U8 telemetryHistoryHead;
+extern U8 telemetryChartChannel;
+
+void Telemetry_HandleFrame(const U8* frame);
+void Telemetry_EndInterval(); // At display rate
+void Telemetry_SetChartChannel(U8 channel); // Starts the chart's history afresh
+
+#endif // TELEMETRY_H
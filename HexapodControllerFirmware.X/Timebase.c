@@ -0,0 +1,42 @@
+// Timebase.c
+// 32-bit microsecond clock from Timer3, see Timebase.h
+
+#include "Timebase.h"
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+#include "Profiler.h"
+
+volatile U32 timebaseOverflows = 0;
+
+void Timebase_Init()
+{
+    TCCR3A = 0;
+    TCCR3B = (1<<CS31); // clk/8, i.e 0.5us per count and overflows every 32.8ms
+    TIMSK3 = (1<<TOIE3);
+}
+
+ISR(TIMER3_OVF_vect)
+{
+    timebaseOverflows++; // First, so this ISR's own trace record already counts the overflow
+    PROFILE_ENTER(PROFILE_TIMER3_OVF, TCNT3);
+
+    PROFILE_EXIT(PROFILE_TIMER3_OVF);
+}
+
+U32 Timebase_Micros()
+{
+    U32 overflows;
+    U16 count;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        count = TCNT3;
+        overflows = timebaseOverflows;
+        // Wrapped while interrupts were off, so the ISR hasn't counted it yet. A small count means the wrap came
+        // before we read TCNT3, a large one that it came just after.
+        if ((TIFR3 & (1<<TOV3)) && count < 0x8000) overflows++;
+    }
+    return (overflows<<15) | (count>>1);
+}
@@ -0,0 +1,18 @@
+// Timebase.h
+// Monotonic microsecond clock shared by scheduling, link round trips, touch timing and ISR profiling
+// Timer3 free runs at 2MHz (clk/8 of 16MHz), and counting its overflows in software extends it to 32 bits of
+// microseconds, which wraps after about 71 minutes. Compare times by subtracting, which stays right across the wrap.
+
+#ifndef TIMEBASE_H
+#define TIMEBASE_H
+
+#include "compiler.h"
+
+#define TIMEBASE_AFTER(time, deadline) ((S32)((time) - (deadline)) >= 0)
+
+extern volatile U32 timebaseOverflows;
+
+void Timebase_Init();
+U32 Timebase_Micros(); // Safe from ISRs too
+
+#endif // TIMEBASE_H
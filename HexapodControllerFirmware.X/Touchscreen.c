@@ -6,11 +6,20 @@
 #include "Touchscreen.h"
 
 #include <avr/pgmspace.h>
+#include <avr/interrupt.h>
 #include <util/delay.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdbool.h>
 
+#ifdef FONT_SUBSET
+#include "FontSubset.h"
+#else
 #include "Fonts.h"
+#endif
+#include "FixedPoint.h"
+#include "Profiler.h"
+#include "Trace.h"
 
 #define ILI9341_TFTWIDTH  240
 #define ILI9341_TFTHEIGHT 320
@@ -69,28 +78,162 @@
 #define ILI9341_GMCTRP1 0xE0
 #define ILI9341_GMCTRN1 0xE1
 
+// SSD1289 and ILI9325 are register based (16-bit index then 16-bit value), ILI9341 takes 8-bit commands with byte parameters
+#define SSD1289_DRIVER_OUTPUT   0x01
+#define SSD1289_DISPLAY_CONTROL 0x07
+#define SSD1289_SLEEP_MODE      0x10
+#define SSD1289_ENTRY_MODE      0x11
+#define SSD1289_GRAM_WRITE      0x22
+#define SSD1289_H_RAM_POS       0x44 // End in high byte, start in low byte
+#define SSD1289_V_RAM_START     0x45
+#define SSD1289_V_RAM_END       0x46
+#define SSD1289_GRAM_X          0x4E
+#define SSD1289_GRAM_Y          0x4F
+
+#define ILI9325_DRIVER_OUTPUT   0x01
+#define ILI9325_ENTRY_MODE      0x03
+#define ILI9325_DISPLAY_CONTROL 0x07
+#define ILI9325_GRAM_X          0x20
+#define ILI9325_GRAM_Y          0x21
+#define ILI9325_GRAM_WRITE      0x22
+#define ILI9325_H_START         0x50
+#define ILI9325_H_END           0x51
+#define ILI9325_V_START         0x52
+#define ILI9325_V_END           0x53
+
+#define TFT_DELAY 0xFF // Pseudo register in init tables, value is a delay in ms
+#define TFT_TABLE_END 0xFFFF
+
 // Private utility function
 inline unsigned char ReverseByte(unsigned char x);
 
-static char swapX;
+// Controller specific init and window setup, selected at compile time in Touchscreen.h so the
+// shared drawing code below calls straight into them with no runtime dispatch
 
-unsigned short TP_X, TP_Y; // Variables holding raw touch data
+#if defined(TFT_SSD1289) || defined(TFT_ILI9325)
 
-void TFT_Init()
+static inline void TFT_WriteRegisterTable(const uint16_t* table)
 {
-	swapX = 1;
+    // Table is pairs of register index and value (register 0 is valid on the SSD1289, hence the end marker)
+    while (1)
+    {
+        uint16_t reg = pgm_read_word(table++);
+        if (reg == TFT_TABLE_END) break;
+        uint16_t value = pgm_read_word(table++);
+        if (reg == TFT_DELAY)
+            while (value--) _delay_ms(1); // _delay_ms needs a constant
+        else
+            TFT_WriteCommandData(reg, value);
+    }
+}
 
-    //RD_PORT |= RD;	// TFT_RD = 1;
-    RST_PORT |= RST;	// TFT_RST=1;
-    _delay_ms(5);
-    RST_PORT &= ~RST;	// TFT_RST=0;
-    _delay_ms(15);
-    RST_PORT |= RST;	// TFT_RST=1;
-    _delay_ms(15);
-    CS_PORT |= CS;	// TFT_CS =0;
-	WR_PORT |= WR;
-	_delay_ms(20);
+#endif
+
+#if defined(TFT_SSD1289)
+
+static inline void TFT_InitController()
+{
+    static const uint16_t init_registers[] PROGMEM = {
+        0x00, 0x0001, // Oscillator on
+        0x03, 0xA8A4, // Power control 1
+        0x0C, 0x0000, // Power control 2
+        0x0D, 0x080C, // Power control 3
+        0x0E, 0x2B00, // Power control 4
+        0x1E, 0x00B7, // Power control 5
+        SSD1289_DRIVER_OUTPUT, 0x2B3F, // 320 lines, BGR, same scan direction as the ILI9341 with MADCTL 0x48
+        0x02, 0x0600, // LCD drive AC control
+        SSD1289_SLEEP_MODE, 0x0000, // Exit sleep
+        TFT_DELAY, 30,
+        SSD1289_ENTRY_MODE, 0x6070, // 65k colour, X and Y increment, horizontal first
+        0x05, 0x0000, 0x06, 0x0000, // Compare registers
+        0x16, 0xEF1C, // Horizontal porch
+        0x17, 0x0003, // Vertical porch
+        0x0B, 0x0000, // Frame cycle control
+        0x0F, 0x0000, // Gate scan start
+        0x41, 0x0000, 0x42, 0x0000, // Vertical scroll
+        0x48, 0x0000, 0x49, 0x013F, // First screen window
+        0x4A, 0x0000, 0x4B, 0x0000, // Second screen window
+        SSD1289_H_RAM_POS, 0xEF00,
+        SSD1289_V_RAM_START, 0x0000,
+        SSD1289_V_RAM_END, 0x013F,
+        0x30, 0x0707, 0x31, 0x0204, 0x32, 0x0204, 0x33, 0x0502, 0x34, 0x0507, // Gamma
+        0x35, 0x0204, 0x36, 0x0204, 0x37, 0x0502, 0x3A, 0x0302, 0x3B, 0x0302,
+        0x23, 0x0000, 0x24, 0x0000, // RAM write data mask
+        0x25, 0x8000, // Frame frequency
+        SSD1289_DISPLAY_CONTROL, 0x0233, // Display on
+        TFT_TABLE_END
+    };
+
+    TFT_WriteRegisterTable(init_registers);
+}
+
+static inline void TFT_SetWindow(unsigned int PX1, unsigned int PY1, unsigned int PX2, unsigned int PY2)
+{
+    TFT_WriteCommandData(SSD1289_H_RAM_POS, (PX2 << 8) | PX1);
+    TFT_WriteCommandData(SSD1289_V_RAM_START, PY1);
+    TFT_WriteCommandData(SSD1289_V_RAM_END, PY2);
+    TFT_WriteCommandData(SSD1289_GRAM_X, PX1);
+    TFT_WriteCommandData(SSD1289_GRAM_Y, PY1);
+    TFT_WriteCommand(SSD1289_GRAM_WRITE);
+}
+
+#elif defined(TFT_ILI9325)
 
+static inline void TFT_InitController()
+{
+    static const uint16_t init_registers[] PROGMEM = {
+        0xE5, 0x78F0, // Internal timing
+        ILI9325_DRIVER_OUTPUT, 0x0100, // Source shift direction, same scan as the ILI9341 with MADCTL 0x48
+        0x02, 0x0200, // Line inversion
+        ILI9325_ENTRY_MODE, 0x1030, // BGR, X and Y increment, horizontal first
+        0x04, 0x0000, // Resize control
+        0x08, 0x0207, // Front and back porch
+        0x09, 0x0000, 0x0A, 0x0000, 0x0C, 0x0000, 0x0D, 0x0000, 0x0F, 0x0000,
+        0x10, 0x0000, 0x11, 0x0007, 0x12, 0x0000, 0x13, 0x0000, // Power sequence
+        ILI9325_DISPLAY_CONTROL, 0x0001,
+        TFT_DELAY, 200,
+        0x10, 0x1690,
+        0x11, 0x0227,
+        TFT_DELAY, 50,
+        0x12, 0x000D,
+        TFT_DELAY, 50,
+        0x13, 0x1200,
+        0x29, 0x000A,
+        0x2B, 0x000D,
+        TFT_DELAY, 50,
+        ILI9325_GRAM_X, 0x0000, ILI9325_GRAM_Y, 0x0000,
+        0x30, 0x0000, 0x31, 0x0404, 0x32, 0x0003, 0x35, 0x0405, 0x36, 0x0808, // Gamma
+        0x37, 0x0407, 0x38, 0x0303, 0x39, 0x0707, 0x3C, 0x0504, 0x3D, 0x0808,
+        ILI9325_H_START, 0x0000, ILI9325_H_END, 0x00EF,
+        ILI9325_V_START, 0x0000, ILI9325_V_END, 0x013F,
+        0x60, 0xA700, // Gate scan, 320 lines
+        0x61, 0x0001, // Normally white
+        0x6A, 0x0000, // No scrolling
+        0x80, 0x0000, 0x81, 0x0000, 0x82, 0x0000, 0x83, 0x0000, 0x84, 0x0000, 0x85, 0x0000, // Partial images off
+        0x90, 0x0010, // Panel interface
+        0x92, 0x0600,
+        ILI9325_DISPLAY_CONTROL, 0x0133, // Display on
+        TFT_TABLE_END
+    };
+
+    TFT_WriteRegisterTable(init_registers);
+}
+
+static inline void TFT_SetWindow(unsigned int PX1, unsigned int PY1, unsigned int PX2, unsigned int PY2)
+{
+    TFT_WriteCommandData(ILI9325_H_START, PX1);
+    TFT_WriteCommandData(ILI9325_H_END, PX2);
+    TFT_WriteCommandData(ILI9325_V_START, PY1);
+    TFT_WriteCommandData(ILI9325_V_END, PY2);
+    TFT_WriteCommandData(ILI9325_GRAM_X, PX1);
+    TFT_WriteCommandData(ILI9325_GRAM_Y, PY1);
+    TFT_WriteCommand(ILI9325_GRAM_WRITE);
+}
+
+#else // TFT_ILI9341
+
+static inline void TFT_InitController()
+{
     static const uint8_t init_commands[] = {
         4, 0xEF, 0x03, 0x80, 0x02,
         4, 0xCF, 0x00, 0XC1, 0X30,
@@ -131,6 +274,48 @@ void TFT_Init()
     _delay_ms(120);
     TFT_WriteCommand(ILI9341_DISPON);
     
+}
+
+static inline void TFT_SetWindow(unsigned int PX1, unsigned int PY1, unsigned int PX2, unsigned int PY2)
+{
+    TFT_WriteCommand(ILI9341_CASET);
+    TFT_WriteData(PX1 >> 8);
+    TFT_WriteData(PX1 & 0xFF);
+    TFT_WriteData(PX2 >> 8);
+    TFT_WriteData(PX2 & 0xFF);
+
+    TFT_WriteCommand(ILI9341_PASET);
+    TFT_WriteData(PY1 >> 8);
+    TFT_WriteData(PY1 & 0xFF);
+    TFT_WriteData(PY2 >> 8);
+    TFT_WriteData(PY2 & 0xFF);
+
+    TFT_WriteCommand(ILI9341_RAMWR);
+}
+
+#endif
+
+static char swapX;
+
+unsigned short TP_X, TP_Y; // Variables holding raw touch data
+
+void TFT_Init()
+{
+	swapX = 1;
+
+    //RD_PORT |= RD;	// TFT_RD = 1;
+    RST_PORT |= RST;	// TFT_RST=1;
+    _delay_ms(5);
+    RST_PORT &= ~RST;	// TFT_RST=0;
+    _delay_ms(15);
+    RST_PORT |= RST;	// TFT_RST=1;
+    _delay_ms(15);
+    CS_PORT |= CS;	// TFT_CS =0;
+	WR_PORT |= WR;
+	_delay_ms(20);
+
+    TFT_InitController();
+
     CS_PORT |= CS;	// TFT_CS =1;
 }
 
@@ -179,19 +364,7 @@ void TFT_SetBounds(unsigned int PX1,unsigned int PY1,unsigned int PX2,unsigned i
 	temp = PX1; PX1 = PX2; PX2 = temp;
 #endif
 
-    TFT_WriteCommand(ILI9341_CASET);
-    TFT_WriteData(PX1 >> 8);
-    TFT_WriteData(PX1 & 0xFF);
-    TFT_WriteData(PX2 >> 8);
-    TFT_WriteData(PX2 & 0xFF);
-
-    TFT_WriteCommand(ILI9341_PASET);
-    TFT_WriteData(PY1 >> 8);
-    TFT_WriteData(PY1 & 0xFF);
-    TFT_WriteData(PY2 >> 8);
-    TFT_WriteData(PY2 & 0xFF);
-
-    TFT_WriteCommand(ILI9341_RAMWR);
+    TFT_SetWindow(PX1, PY1, PX2, PY2);
 }
 
 void TFT_Fill(unsigned int color)
@@ -202,6 +375,7 @@ void TFT_Fill(unsigned int color)
 void TFT_Box(unsigned int x1,unsigned int y1,unsigned int x2,unsigned int y2,unsigned int color)
 {
     unsigned int  i,j;
+    TRACE(TRACE_BOX_BEGIN, x2-x1+1);
     TFT_SetBounds(x1,y1,x2,y2);
     TFT_WriteData(color);
     CS_PORT &= ~CS;	// TFT_CS  = 0;
@@ -214,6 +388,7 @@ void TFT_Box(unsigned int x1,unsigned int y1,unsigned int x2,unsigned int y2,uns
         }
     }
     CS_PORT |= CS;	// TFT_CS  = 1;
+    TRACE(TRACE_BOX_END, x2-x1+1);
 }
 
 void TFT_H_Line(unsigned int x1, unsigned int x2, unsigned int y_pos,unsigned int color)
@@ -242,9 +417,15 @@ void TFT_Char(char c,unsigned int x,unsigned int y, char scale,unsigned int Fcol
 	unsigned short j;
 	unsigned short temp; 
 
+	TRACE(TRACE_CHAR_BEGIN, c);
 	CS_PORT &= ~CS;
 
+	if (c < ' ' || c > '~') c = '?'; // Either font only covers printable ASCII, and parameter names come from the hexapod
+#ifdef FONT_SUBSET
+	temp = pgm_read_byte(&FONT_REMAP[c-32])*32; // 32 bytes per char
+#else
 	temp = (c-32)*32; // 32 bytes per char
+#endif
 
 	unsigned short col;
 	
@@ -260,7 +441,11 @@ void TFT_Char(char c,unsigned int x,unsigned int y, char scale,unsigned int Fcol
 			for (int zz=0; zz <= 1; zz++)
 #endif
 			{
+#ifdef FONT_SUBSET
+				ch=pgm_read_byte(&FONT_16x16_SUBSET[temp+zz]);
+#else
 				ch=pgm_read_byte(&FONT_16x16[temp+zz]);
+#endif
 
 #ifdef ROTATE180
 				// Don't reverse byte
@@ -288,6 +473,7 @@ void TFT_Char(char c,unsigned int x,unsigned int y, char scale,unsigned int Fcol
 	}
 
 	CS_PORT |= CS;
+	TRACE(TRACE_CHAR_END, c);
 }
 
 
@@ -309,6 +495,133 @@ void TFT_CentredText(const char* S, unsigned int x, unsigned int y, char scale,
 
 
 // Touch screen stuff
+#define TOUCH_CMD_X 0x90 // Start bit, X channel, 12-bit, differential reference, power down between conversions
+#define TOUCH_CMD_Y 0xD0
+#define TOUCH_MODE_8BIT 0x08 // MODE bit of the control byte, 8-bit conversions need 4 fewer clocks
+#define TOUCH_SAMPLES 5
+#define TOUCH_FAST_SAMPLES 3 // For 8-bit reads, plenty to hit-test a button
+#define TOUCH_CALIBRATE_SAMPLES 8 // Most that fit the bit-banged int sums
+
+static U8 touchMode = 0; // 0 or TOUCH_MODE_8BIT
+static U8 touchSamples = TOUCH_SAMPLES;
+
+// 8 gives fast, coarse reads for pen down and button taps, anything else the full 12 bits for slider drags.
+// 8-bit results are shifted up to the 12-bit range, so Touch_GetX and Touch_GetY work the same either way.
+void Touch_SetPrecision(char precision)
+{
+	if (precision == 8)
+	{
+		touchMode = TOUCH_MODE_8BIT;
+		touchSamples = TOUCH_FAST_SAMPLES;
+	}
+	else
+	{
+		touchMode = 0;
+		touchSamples = TOUCH_SAMPLES;
+	}
+}
+
+#ifdef TOUCH_HW_SPI
+// Touch_Read only starts a burst of samples, and SPI_STC_vect clocks each byte of it out in the background. So
+// TP_X and TP_Y are from the burst started by the previous poll, about 33ms old, which is fine for a finger.
+// Each conversion is 3 bytes: the command, then one busy clock and the 12 result bits spread over the next two.
+static volatile bool touchBusy = false;
+static U8 touchStep, touchSample, touchHigh, validSamples;
+static U8 burstMode, burstSamples; // Latched at the start of a burst, Touch_SetPrecision may be called during one
+static U16 sampleX, sumX, sumY;
+
+void Touch_Init()
+{
+	T_CS_PORT |= T_CS;
+	T_SPI_DDR |= T_CS + T_SCK + T_MOSI;
+	SPCR = (1<<SPIE) | (1<<SPE) | (1<<MSTR) | (1<<SPR0); // Mode 0, fosc/16 = 1MHz (XPT2046 allows up to 2.5MHz)
+}
+
+// After the busy clock an 8-bit result is the low 7 bits of the first byte and the top bit of the second,
+// and a 12-bit one the low 7 then the top 5
+static inline U16 Touch_SpiResult(U8 high, U8 low)
+{
+	if (burstMode) return (((high<<1) | (low>>7)) & 0xFF) << 4;
+	return ((high<<5) | (low>>3)) & 0xFFF;
+}
+
+void Touch_Read()
+{
+	if (touchBusy) return; // Last burst still running, e.g the main loop held interrupts off for a while
+
+	touchBusy = true;
+	burstMode = touchMode;
+	burstSamples = touchSamples;
+	touchStep = 0;
+	touchSample = 0;
+	validSamples = 0;
+	sumX = 0;
+	sumY = 0;
+	T_CS_PORT &= ~T_CS;
+	SPDR = TOUCH_CMD_X | burstMode;
+}
+
+ISR(SPI_STC_vect)
+{
+	PROFILE_ENTER(PROFILE_SPI_STC, LATENCY_NOT_MEASURED); // Flag is only set by our own transfers, so there's no interrupt condition to time from
+
+	U8 data = SPDR;
+	switch (touchStep++)
+	{
+		case 0: // Command out, clock the result in
+		case 3:
+			SPDR = 0;
+			break;
+
+		case 1:
+		case 4:
+			touchHigh = data;
+			SPDR = 0;
+			break;
+
+		case 2:
+			sampleX = Touch_SpiResult(touchHigh, data);
+			SPDR = TOUCH_CMD_Y | burstMode;
+			break;
+
+		case 5:
+		{
+			U16 sampleY = Touch_SpiResult(touchHigh, data);
+			if (sampleX > 0 && sampleY > 0) // Valid sample
+			{
+				sumX += sampleX;
+				sumY += sampleY;
+				validSamples++;
+			}
+
+			if (++touchSample < burstSamples && Touch_DataAvailable())
+			{
+				touchStep = 0;
+				SPDR = TOUCH_CMD_X | burstMode;
+				break;
+			}
+
+			T_CS_PORT |= T_CS;
+			if (validSamples > 0)
+			{
+				TP_X = sumX/validSamples;
+				TP_Y = sumY/validSamples;
+			}
+			else
+			{
+				TP_X = -1;
+				TP_Y = -1;
+			}
+			touchBusy = false;
+			break;
+		}
+	}
+
+	PROFILE_EXIT(PROFILE_SPI_STC);
+}
+
+#else
+
 void Touch_Init()
 {
 	//T_DDR  |= T_CS + T_CLK + T_DIN;
@@ -325,12 +638,12 @@ void Touch_Read()
 	T_CS_PORT &= ~T_CS; //cbi(P_CS, B_CS);                    
 
 	int tempx=0, tempy=0, x=0, y=0, samples=0;
-	for (int i=0; i<5; i++)
+	for (int i=0; i<touchSamples; i++)
 	{
 
 		if (!(T_IRQ_PIN & T_IRQ)) // T_IRQ_PIN was PINE
 		{
-			Touch_WriteData(0x90);
+			Touch_WriteData(TOUCH_CMD_X | touchMode);
 			T_CLK_PORT |= T_CLK;
 			T_CLK_PORT &= ~T_CLK;
 			tempx = Touch_ReadData();
@@ -338,7 +651,7 @@ void Touch_Read()
 
 		if (!(T_IRQ_PIN & T_IRQ))
 		{
-			Touch_WriteData(0xD0);
+			Touch_WriteData(TOUCH_CMD_Y | touchMode);
 			T_CLK_PORT |= T_CLK;
 			T_CLK_PORT &= ~T_CLK;
 			tempy = Touch_ReadData();
@@ -366,6 +679,31 @@ void Touch_Read()
 	T_CS_PORT |= T_CS; //sbi(P_CS, B_CS);
 }
 
+#endif
+
+// Touch_Read that only returns once TP_X and TP_Y are from this read, so with TOUCH_HW_SPI interrupts must be enabled
+void Touch_ReadBlocking()
+{
+#ifdef TOUCH_HW_SPI
+	while (touchBusy); // Let a burst already in progress finish, then run ours
+	Touch_Read();
+	while (touchBusy);
+#else
+	Touch_Read();
+#endif
+}
+
+// Full precision read with extra samples, blocking until done
+void Touch_CalibrateRead()
+{
+	U8 mode = touchMode, samples = touchSamples;
+	touchMode = 0;
+	touchSamples = TOUCH_CALIBRATE_SAMPLES;
+	Touch_ReadBlocking();
+	touchMode = mode;
+	touchSamples = samples;
+}
+
 char Touch_DataAvailable()
 {
 	return !(T_IRQ_PIN & T_IRQ);//avail;
@@ -378,9 +716,9 @@ unsigned short Touch_GetX()
 	if (TP_X > 3950) TP_X = 3950;
 	int x;
 	if (swapX)
-		x = (3950-TP_X) * 8 / 95; // Scales 0-3800 down to 0-320
+		x = FP_MulQ16(3950-TP_X, FP_Q16(8, 95)); // Scales 0-3800 down to 0-320
 	else
-		x = (TP_X-150) * 8 / 95;
+		x = FP_MulQ16(TP_X-150, FP_Q16(8, 95));
 
 #ifdef ROTATE180
 	return 319-x;
@@ -394,7 +732,7 @@ unsigned short Touch_GetY()
 	// Raw scale for Y goes ~200 (top) to ~3900 (bottom), i.e range 3700
 	if (TP_Y < 200) TP_Y = 200;
 	if (TP_Y > 3900) TP_Y = 3900;
-	int y = (TP_Y-200) * 6 / 92; // close to * 320 / 3700
+	int y = FP_MulQ16(TP_Y-200, FP_Q16(6, 92)); // close to * 320 / 3700
 
 #ifdef ROTATE180
 	return 239-y;
@@ -403,6 +741,32 @@ unsigned short Touch_GetY()
 #endif
 }
 
+#ifdef TOUCH_HW_SPI
+// Blocking transfer with the interrupt masked so SPI_STC_vect doesn't take the byte, not for use during a burst
+static U8 Touch_Transfer(U8 data)
+{
+	SPCR &= ~(1<<SPIE);
+	SPDR = data;
+	while (!(SPSR & (1<<SPIF)));
+	data = SPDR;
+	SPCR |= (1<<SPIE);
+	return data;
+}
+
+void Touch_WriteData(unsigned char data)
+{
+	Touch_Transfer(data);
+}
+
+unsigned short Touch_ReadData() // Includes the busy clock, unlike the bit-banged version
+{
+	burstMode = touchMode;
+	U8 high = Touch_Transfer(0);
+	return Touch_SpiResult(high, Touch_Transfer(0));
+}
+
+#else
+
 void Touch_WriteData(unsigned char data)
 {
 	T_CLK_PORT &= ~T_CLK; //cbi(P_CLK, B_CLK);
@@ -423,7 +787,8 @@ unsigned short Touch_ReadData()
 {
 	unsigned short data = 0;
 
-	for (char bit=0; bit<12; bit++)
+	char bits = touchMode ? 8 : 12;
+	for (char bit=0; bit<bits; bit++)
 	{
 		data = data<<1;
 		T_CLK_PORT |= T_CLK; //sbi(P_CLK, B_CLK);
@@ -432,9 +797,12 @@ unsigned short Touch_ReadData()
 			data++;
 	}
 
+	if (touchMode) data <<= 4; // Same scale as 12-bit reads
 	return data;
 }
 
+#endif
+
 inline unsigned char ReverseByte(unsigned char x)
 {
     static const unsigned char reverso[] = {
@@ -1,11 +1,21 @@
 // Touchscreen.h
-// Functions for controlling 320x240 pixel TFT touchscreens (ILI9341 only)
+// Functions for controlling 320x240 pixel TFT touchscreens (ILI9341/SSD1289/ILI9325)
 // For AT90CAN64/128 microcontrollers
 // By Ian Hooper (ZEVA), released under open source MIT License
 
 #include <avr/io.h>
 
 #define ROTATE180 // Rotate 180 degrees (some panels have better contrast from above or below)
+#define FONT_SUBSET // Use only the glyphs the UI draws, from FontSubset.h (generated at build time by Tools/fontsubset.py)
+
+// Display controller, choose one to suit the panel fitted (older handsets use SSD1289 or ILI9325)
+#define TFT_ILI9341
+//#define TFT_SSD1289
+//#define TFT_ILI9325
+
+#if defined(TFT_ILI9341) + defined(TFT_SSD1289) + defined(TFT_ILI9325) != 1
+#error "Define exactly one of TFT_ILI9341, TFT_SSD1289 or TFT_ILI9325"
+#endif
 
 // TFT pins
 #define	RST			(1<<PG1)
@@ -24,7 +34,16 @@
 #define	DP_Hi		PORTA
 #define DP_Hi_DDR	DDRA
 
+//#define TOUCH_HW_SPI // Touch controller on the hardware SPI pins (later board revisions), otherwise bit-banged
+
 // Touch Screen stuff, I/O pins we need - all on PORT E
+#ifdef TOUCH_HW_SPI
+#define T_CS		(1<<PB0) // Doubles as SS, which must be an output to stay SPI master
+#define T_CS_PORT	PORTB
+#define T_SCK		(1<<PB1)
+#define T_MOSI		(1<<PB2)
+#define T_SPI_DDR	DDRB // MISO (PB3) is left as an input
+#else
 //#define T_DDR		DDRF // applied to T_CS, T_CLK, T_DIN
 #define	T_CLK		(1<<PF6)
 #define T_CLK_PORT	PORTF
@@ -34,6 +53,7 @@
 #define T_DIN_PORT	PORTD
 #define T_DOUT		(1<<PD0)
 #define T_DOUT_PIN	PIND
+#endif
 #define T_IRQ		(1<<PF7) // ("PEN")
 #define T_IRQ_PIN	PINF
 
@@ -70,6 +90,7 @@ void TFT_CentredText(const char* S, unsigned int x, unsigned int y, char scale,
 // Touch functions
 void Touch_Init();
 void Touch_Read();
+void Touch_ReadBlocking();
 char Touch_DataAvailable();
 unsigned short Touch_GetX();
 unsigned short Touch_GetY();
@@ -0,0 +1,60 @@
+// Trace.c
+// Trace ring buffer and its dump, see Trace.h
+// A dump is "TRC", the version, the little endian record count, then that many TraceRecords oldest first. Tracing
+// is paused while it goes out so the dump doesn't trace itself, and the ring starts empty afterwards.
+
+#include "Trace.h"
+
+#ifdef TRACE_ENABLED
+
+#include "DebugUart.h"
+
+TraceRecord traceRecords[TRACE_RECORDS];
+U8 traceHead = 0;
+U16 traceCount = 0;
+bool tracePaused = false;
+U16 traceFrozenFrame = 0;
+
+static U32 frameStart;
+
+void Trace_Dump()
+{
+    tracePaused = true;
+
+    DebugUart_Start(DEBUG_UART_LOG_UBRR, (1<<TXEN0));
+
+    U16 records = traceCount < TRACE_RECORDS ? traceCount : TRACE_RECORDS;
+    DebugUart_SendBytes("TRC", 3);
+    DebugUart_Send(TRACE_VERSION);
+    DebugUart_SendBytes(&records, sizeof(records));
+    for (U8 n = (traceHead - records) & (TRACE_RECORDS-1); records--; n = (n + 1) & (TRACE_RECORDS-1))
+        DebugUart_SendBytes(&traceRecords[n], sizeof(TraceRecord));
+
+    DebugUart_Flush();
+    DebugUart_Stop();
+
+    traceCount = 0;
+    traceFrozenFrame = 0;
+    tracePaused = false;
+    frameStart = Timebase_Micros(); // The dump's own pass is slow, and not what we're after
+}
+
+void Trace_BeginFrame()
+{
+    frameStart = Timebase_Micros();
+    TRACE(TRACE_FRAME_BEGIN, 0);
+}
+
+void Trace_EndFrame()
+{
+    U32 time = Timebase_Micros() - frameStart;
+    U16 millis = time > 0xFFFFUL*1000 ? 0xFFFF : time/1000;
+    TRACE(TRACE_FRAME_END, millis);
+    if (TRACE_FREEZE_US && time > TRACE_FREEZE_US && !tracePaused)
+    {
+        tracePaused = true;
+        traceFrozenFrame = millis;
+    }
+}
+
+#endif
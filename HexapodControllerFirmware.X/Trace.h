@@ -0,0 +1,104 @@
+// Trace.h
+// Event tracing into a RAM ring buffer, for finding where a slow frame actually spent its time
+// Each TRACE() stores a 6 byte record of event, Timer3 timestamp and a 16 bit payload, overwriting the oldest once
+// the ring is full. Trace_Dump sends the ring out of USART0 and Tools/tracetimeline.py turns that into a timeline.
+// A main loop pass slower than TRACE_FREEZE_US freezes the ring at its end, so a dump shows that pass and what
+// led up to it rather than whatever came after.
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdbool.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+#include "compiler.h"
+#include "Timebase.h"
+
+//#define TRACE_ENABLED // Costs TRACE_RECORDS * 6 bytes of RAM and a little time at every tracepoint
+
+#define TRACE_RECORDS   128 // Must be a power of 2 no bigger than 256
+#define TRACE_VERSION   1
+#define TRACE_FREEZE_US 100000 // Longer than a control period, so control went out late. 0 never freezes
+
+// Compile-time filters, a bit per TraceEvents entry and per ProfiledIsrs entry (Profiler.h). The Timer0 backlight
+// ISRs are left out by default, as between them they'd fill the ring in under 4ms.
+#define TRACE_EVENT_MASK    0xFFFFUL
+#define TRACE_ISR_MASK      (~((1UL<<PROFILE_TIMER0_OVF) | (1UL<<PROFILE_TIMER0_COMP)))
+
+// Tools/tracetimeline.py reads these names from here, so keep one per line. Pairs ending _BEGIN and _END become
+// spans on the timeline, anything else a single instant.
+enum TraceEvents {
+    TRACE_FRAME_BEGIN, // One pass of the main loop
+    TRACE_FRAME_END, // Payload is the pass's length in milliseconds
+    TRACE_ISR_BEGIN, // Payload is the ProfiledIsrs index
+    TRACE_ISR_END,
+    TRACE_REDRAW_BEGIN, // Full page redraw, payload is the page
+    TRACE_REDRAW_END,
+    TRACE_BOX_BEGIN, // TFT_Box, payload is width
+    TRACE_BOX_END,
+    TRACE_CHAR_BEGIN, // TFT_Char, payload is the character
+    TRACE_CHAR_END,
+    TRACE_TRANSMIT_BEGIN, // One byte to the radio, payload is the byte
+    TRACE_TRANSMIT_END,
+    TRACE_TOUCH_DOWN, // Payload is x
+    TRACE_TOUCH_UP,
+    TRACE_BUTTON, // Main loop acting on a press, payload is the button
+    NUM_TRACE_EVENTS
+};
+
+typedef struct
+{
+    U8 event;
+    U8 overflows; // Low byte of timebaseOverflows, so the tool can put time back together
+    U16 time; // TCNT3
+    U16 payload;
+} TraceRecord;
+
+#ifdef TRACE_ENABLED
+
+extern TraceRecord traceRecords[TRACE_RECORDS];
+extern U8 traceHead;
+extern U16 traceCount; // Records written since the last dump, those beyond TRACE_RECORDS were overwritten
+extern bool tracePaused;
+extern U16 traceFrozenFrame; // Milliseconds of the pass that froze the ring, 0 while still recording
+
+void Trace_Dump(); // Blocks until sent, so only from the main loop and never while bridging. Restarts a frozen ring.
+void Trace_BeginFrame();
+void Trace_EndFrame(); // Freezes the ring if this pass took longer than TRACE_FREEZE_US
+
+// Inlined so a tracepoint in an ISR doesn't make it push every call-used register
+static inline void Trace_Record(U8 event, U16 payload)
+{
+    U8 sreg = SREG;
+    cli();
+    if (!tracePaused)
+    {
+        TraceRecord* record = &traceRecords[traceHead];
+        traceHead = (traceHead + 1) & (TRACE_RECORDS-1);
+        traceCount++;
+        record->time = TCNT3;
+        record->overflows = (U8)timebaseOverflows;
+        if ((TIFR3 & (1<<TOV3)) && record->time < 0x8000) record->overflows++; // Overflow not yet counted by its ISR
+        record->event = event;
+        record->payload = payload;
+    }
+    SREG = sreg;
+}
+
+// The masks are constant, so filtered out tracepoints compile to nothing
+#define TRACE(event, payload) do { if (TRACE_EVENT_MASK & (1UL<<(event))) Trace_Record(event, payload); } while (0)
+#define TRACE_ISR(event, isr) do { if (TRACE_ISR_MASK & (1UL<<(isr))) TRACE(event, isr); } while (0)
+#define TRACE_BEGIN_FRAME() Trace_BeginFrame()
+#define TRACE_END_FRAME() Trace_EndFrame()
+
+#else
+
+#define TRACE(event, payload) ((void)0)
+#define TRACE_ISR(event, isr) ((void)0)
+#define TRACE_BEGIN_FRAME() ((void)0)
+#define TRACE_END_FRAME() ((void)0)
+
+#endif
+
+#endif // TRACE_H
@@ -16,10 +16,21 @@
 #include <avr/pgmspace.h>
 #define __DELAY_BACKWARD_COMPATIBLE__
 #include <util/delay.h>
+#include <util/atomic.h>
 #include <stdbool.h>
 
 #include "Touchscreen.h"
 #include "compiler.h"
+#include "Profiler.h"
+#include "FixedPoint.h"
+#include "Protocol.h"
+#include "Link.h"
+#include "Params.h"
+#include "Bridge.h"
+#include "Telemetry.h"
+#include "Timebase.h"
+#include "Trace.h"
+#include "DebugUart.h"
 
 #define RETRACT_RX_CAN_ID       0x18FFEC10  // i.e we send, retract receives
 #define LEFT_RETRACT_TX_CAN_ID  0x18FFEC00  // retract sends, we receive
@@ -32,11 +43,35 @@
 #define BACKLIGHT_PORT	PORTD
 #define BACKLIGHT_DDR	DDRD
 
+#define BENCHMARKS // Hidden page timing the display, touch, UART and ADC on the real hardware, comment out to leave it out
+
+#ifdef BENCHMARKS
+#define BENCH_UART_UBRR     3 // 250k baud, exact at 16MHz
+#define BENCH_UART_BYTES    64
+#define BENCH_UART_TIMEOUT  2000 // Microseconds without a byte back before giving up, i.e nothing looped back
+#define BENCH_TOUCH_WAIT    5000000 // Microseconds to wait for the screen to be held for the touch benchmarks
+#define BENCH_MATH_REPEATS  256 // Sets of touch scaling timed together, well beyond the timebase's 0.5us steps
+#endif
+
 // Name the ADC channels
 enum ADCs { V_BATT, LEFT_X, LEFT_Y, RIGHT_X, RIGHT_Y };
 
 enum Page {
-    MAIN_PAGE // Probably only one page
+    MAIN_PAGE,
+    PARAMS_PAGE, // Hexapod gait settings, from its parameter server
+    TELEMETRY_PAGE, // Min/mean/max readouts and chart of one telemetry channel
+    BRIDGE_PAGE, // PC to hexapod passthrough for reflashing or debugging
+#ifdef ISR_PROFILING
+    ISR_STATS_PAGE, // Hidden diagnostics, reached by tapping the title bar
+    LATENCY_PAGE,
+#endif
+#ifdef BENCHMARKS
+    BENCHMARK_PAGE,
+#endif
+#ifdef TRACE_ENABLED
+    TRACE_PAGE,
+#endif
+    NUM_PAGES
 };
 
 // Different walking types are sent as bitfield, first byte of command message
@@ -46,6 +81,14 @@ enum Page {
 #define QUICK_STEP_BIT	0b00001000 // Bit 3 for normal or quick (shorter) steps
 #define RIPPLE_BIT		0b00010000 // Bit 4 to select ripple gait instead of tripod
 
+#define CONTROL_PERIOD      100000 // Microseconds, i.e 10Hz
+#define TOUCH_SETTLE_TIME   60000 // Microseconds of contact before a touch counts, i.e the third 30Hz poll
+
+#define CHART_TOP       70 // Telemetry chart area, one TELEMETRY_HISTORY column per 8 pixels across the full width
+#define CHART_BOTTOM    205
+
+#define HIGH_RES_CONTROL // Send full 10-bit joystick axes in packed frames, comment out for robots on the original 8-bit protocol
+
 // Initialising all the buttons
 typedef struct
 {
@@ -73,6 +116,15 @@ enum Buttons {
     RED_EYES,
     GREEN_EYES,
     BLUE_EYES,
+    PARAMS_PREV,
+    PARAMS_NEXT,
+    BRIDGE_START,
+#ifdef BENCHMARKS
+    BENCHMARK_RUN,
+#endif
+#ifdef TRACE_ENABLED
+    TRACE_DUMP,
+#endif
     NUM_BUTTONS
 };
 Button buttons[NUM_BUTTONS];
@@ -84,18 +136,60 @@ typedef struct
     U16 colour;
     S8 value, oldValue;
     U8 page;
+    U16 percentPerPixel, pixelsPerPercent; // Q8.8 scales, worked out once in InitialiseSlider so touch and render need no division
 } Slider;
 
 enum Sliders {
     FRONT_SERVO,
     BACK_SERVO,
+    PARAM_SLIDER_1, // One per row of the settings page
+    PARAM_SLIDER_2,
+    PARAM_SLIDER_3,
+    PARAM_SLIDER_4,
     NUM_SLIDERS,
 };
 Slider sliders[NUM_SLIDERS];
 
+#define PARAM_ROWS 4 // Settings page shows this many parameters at a time
+
+#ifdef BENCHMARKS
+enum Benchmarks {
+    BENCH_FILL, // Microseconds per full screen fill
+    BENCH_TEXT_1, // Microseconds per 8 characters at each scale
+    BENCH_TEXT_2,
+    BENCH_TEXT_3,
+    BENCH_BUTTON, // Microseconds per button redraw
+    BENCH_TOUCH_8, // Microseconds per Touch_Read at each precision
+    BENCH_TOUCH_12,
+    BENCH_UART, // Bytes per second through a loopback on USART0 (TXD0 wired to RXD0)
+    BENCH_ADC, // Scans of all five ADC channels per second
+    BENCH_MATH_DIVIDE, // CPU cycles per Touch_GetX, Touch_GetY and slider percentage, with the divisions they used to have
+    BENCH_MATH_RECIPROCAL, // The same with the FixedPoint.h reciprocal multiplies they have now
+    NUM_BENCHMARKS
+};
+#endif
+
 // Function declarations
-void Transmit(unsigned char c);
 void RenderMainPage();
+#ifdef ISR_PROFILING
+void RenderIsrStatsPage();
+void RenderLatencyPage();
+#endif
+void RenderParamsPage();
+void RenderTelemetryPage();
+void RenderBridgePage();
+#ifdef BENCHMARKS
+void RenderBenchmarkPage();
+void RunBenchmarks();
+U32 BenchmarkUart();
+U32 BenchmarkTouchMath(U8 benchmark);
+#endif
+#ifdef TRACE_ENABLED
+void RenderTracePage();
+#endif
+void ChangePage(U8 page);
+void RedrawPage();
+void SendControl(U16 leftX, U16 leftY, U16 rightX, U16 rightY);
 void HandleTouchDown();
 void HandleTouchUp();
 void AddDecimalPoint(char* buffer);
@@ -103,7 +197,7 @@ void AddDecimalPoint2(char* buffer);
 void AddTrailingSpaces(char* buffer, U8 totalLength);
 int ReadADC(unsigned char channel);
 void SetupPorts();
-void InitialiseButton(U8 button, U16 x, U16 y, U16 width, U16 colour, const char* text, U8 selected);
+void InitialiseButton(U8 button, U16 x, U16 y, U16 width, U16 colour, const char* text, U8 selected, U8 page);
 void SelectButton(S8 newButton, S8 oldButton, S8 otherOldButton);
 void InitialiseSlider(U8 slider, U16 x, U16 y, U16 width, U16 colour, S8 value, U8 page);
 inline void RenderBorderBox(int lx, int ly, int rx, int ry, U16 Fcolor, U16 colour);
@@ -115,13 +209,46 @@ void DrawBattery(int x, int y, int percentage);
 
 char buffer[30]; // Used for sprintf functions
 
-short ticks = 0; // For main loop timing
+U32 nextControlTime = 0; // Timebase_Micros of the next control period
+
+U8 shownLink = 0xFF; // Link indicator state last drawn
+bool shownLinkHealthy;
+
+U8 paramsFirstRow = 0; // Index of the parameter in the top row of the settings page
+U8 paramPercent[PARAM_ROWS]; // Slider positions last applied to the parameters
+U8 shownParamState = 0xFF;
+U8 shownParamsFetched;
+
+#ifdef ISR_PROFILING
+const char* isrNames[NUM_PROFILED_ISRS] = { "T0 OVF", "T0 CMP", "T1 OVF", "U1 RX", "SPI", "U0 RX", "U0 TX", "U1 TX", "T3 OVF",
+    "CAN" };
+U8 latencyIsr = 0; // ISR shown on the latency page
+volatile bool latencyIsrChangeRequested = false; // Left to the main loop, which owns the redraw flag
+#endif
+
+const char* telemetryNames[NUM_TELEMETRY_CHANNELS] = { "Battery (mV)", "Current (mA)",
+    "Leg 1 (mA)", "Leg 2 (mA)", "Leg 3 (mA)", "Leg 4 (mA)", "Leg 5 (mA)", "Leg 6 (mA)" };
+
+#ifdef BENCHMARKS
+const char* benchNames[NUM_BENCHMARKS] = { "Fill", "Text x1", "Text x2", "Text x3", "Button", "Touch 8", "Touch 12",
+    "UART", "ADC scan", "Div math", "FP math" };
+const char* benchUnits[NUM_BENCHMARKS] = { "us", "us", "us", "us", "us", "us", "us", "B/s", "/s", "cyc", "cyc" };
+U32 benchResults[NUM_BENCHMARKS]; // 0 until run, or when that benchmark couldn't run
+#endif
+
+U32 shownToRobot, shownToPc; // Bridge byte counts at the last refresh, for the rates
 
 int displayBrightness = 0; // Inverted, 0 means full bright
 volatile bool displayNeedsFullRedraw = true;
 U8 currentPage = MAIN_PAGE;
+volatile bool pageChangeRequested = false;
+volatile bool chartChannelChangeRequested = false; // Left to the main loop, which owns the telemetry history
+bool pageNeedsRefresh = false; // For pages showing live values, set at 2Hz
+U8 pageRefreshCount = 0;
 
-short touchTimer;
+bool touching = false;
+bool touchAccepted = false; // Held for TOUCH_SETTLE_TIME, so now hit tested or dragging
+U32 touchDownTime; // Timebase_Micros at first contact
 int touchX, touchY;
 S8 buttonPressed = -1;
 S8 touchedSlider = -1;
@@ -148,72 +275,107 @@ inline bool SliderTouched(Slider* slider)
         && currentPage == slider->page;
 }
 
+// Timers 0 and 1 count at 2MHz like Timer3, so their count since the interrupt condition is the ISR latency
 ISR(TIMER0_OVF_vect) // Called at 7812Hz, i.e every 2048 cycles of 16Mhz clock
 {
-	ticks++; // Used for main loop timing
+	PROFILE_ENTER(PROFILE_TIMER0_OVF, TCNT0);
 
 	BACKLIGHT_PORT &= ~BACKLIGHT;
+
+	PROFILE_EXIT(PROFILE_TIMER0_OVF);
 }
 
 ISR(TIMER0_COMP_vect)
 {
+	PROFILE_ENTER(PROFILE_TIMER0_COMP, (U8)(TCNT0 - OCR0A));
+
 	if (displayBrightness < 254) // 254 is for 0% night brightness, and 255 is for actually off, but both should have no backlight
 		BACKLIGHT_PORT |= BACKLIGHT;	
+
+	PROFILE_EXIT(PROFILE_TIMER0_COMP);
 }
 
 ISR(TIMER1_OVF_vect) // Interrupts at about 30Hz
 {
+	PROFILE_ENTER(PROFILE_TIMER1_OVF, TCNT1);
+
 	OCR0A = displayBrightness; // Updates backlight PWM, inverted due to PNP transistor
 	
 	// Poll touchscreen
 	if (Touch_DataAvailable())
 	{
 		Touch_Read();
-		touchTimer++;
+		if (!touching)
+		{
+			touching = true;
+			touchDownTime = Timebase_Micros();
+		}
 		HandleTouchDown();
 	}
 	else
 	{
-		if (touchTimer > 0) HandleTouchUp();
-		touchTimer = 0;
+		if (touching) HandleTouchUp();
+		touching = false;
+		touchAccepted = false;
 		touchX = -1;
 		touchY = -1;
 	}
+
+	PROFILE_EXIT(PROFILE_TIMER1_OVF);
 }
 
 int main(void)
 {
 	SetupPorts();
 
-    InitialiseButton(WALK_MODE, 140, 30, 100, BLUE, "Walk", true);
-    InitialiseButton(WIGGLE_MODE, 260, 30, 100, BLUE, "Wiggle", false);
+    InitialiseButton(WALK_MODE, 140, 30, 100, BLUE, "Walk", true, MAIN_PAGE);
+    InitialiseButton(WIGGLE_MODE, 260, 30, 100, BLUE, "Wiggle", false, MAIN_PAGE);
     
-    InitialiseButton(TRIPOD_GAIT, 140, 65, 100, BLUE, "Tripod", true);
-    InitialiseButton(RIPPLE_GAIT, 260, 65, 100, BLUE, "Ripple", false);
+    InitialiseButton(TRIPOD_GAIT, 140, 65, 100, BLUE, "Tripod", true, MAIN_PAGE);
+    InitialiseButton(RIPPLE_GAIT, 260, 65, 100, BLUE, "Ripple", false, MAIN_PAGE);
     
-    InitialiseButton(LOW_BODY, 140, 100, 100, BLUE, "Low", true);
-    InitialiseButton(HIGH_BODY, 260, 100, 100, BLUE, "High", false);
+    InitialiseButton(LOW_BODY, 140, 100, 100, BLUE, "Low", true, MAIN_PAGE);
+    InitialiseButton(HIGH_BODY, 260, 100, 100, BLUE, "High", false, MAIN_PAGE);
     
-    InitialiseButton(LOW_STEP, 140, 135, 100, BLUE, "Low", true);
-    InitialiseButton(HIGH_STEP, 260, 135, 100, BLUE, "High", false);
+    InitialiseButton(LOW_STEP, 140, 135, 100, BLUE, "Low", true, MAIN_PAGE);
+    InitialiseButton(HIGH_STEP, 260, 135, 100, BLUE, "High", false, MAIN_PAGE);
     
-    InitialiseButton(LONG_STEP, 140, 170, 100, BLUE, "Long", true);
-    InitialiseButton(QUICK_STEP, 260, 170, 100, BLUE, "Quick", false);
+    InitialiseButton(LONG_STEP, 140, 170, 100, BLUE, "Long", true, MAIN_PAGE);
+    InitialiseButton(QUICK_STEP, 260, 170, 100, BLUE, "Quick", false, MAIN_PAGE);
         
-    InitialiseButton(RED_EYES, 122, 205, 64, RED, "Red", false);
-    InitialiseButton(GREEN_EYES, 200, 205, 70, GREEN, "Green", true);
-    InitialiseButton(BLUE_EYES, 278, 205, 64, BLUE, "Blue", false);
+    InitialiseButton(RED_EYES, 122, 205, 64, RED, "Red", false, MAIN_PAGE);
+    InitialiseButton(GREEN_EYES, 200, 205, 70, GREEN, "Green", true, MAIN_PAGE);
+    InitialiseButton(BLUE_EYES, 278, 205, 64, BLUE, "Blue", false, MAIN_PAGE);
+    
+    for (U8 n=0; n<PARAM_ROWS; n++)
+        InitialiseSlider(PARAM_SLIDER_1 + n, 235, 32 + n*44, 160, BLUE, 0, PARAMS_PAGE);
+    InitialiseButton(PARAMS_PREV, 200, 205, 70, BLUE, "Prev", false, PARAMS_PAGE);
+    InitialiseButton(PARAMS_NEXT, 278, 205, 64, BLUE, "Next", false, PARAMS_PAGE);
+    
+    InitialiseButton(BRIDGE_START, 160, 205, 100, BLUE, "Start", false, BRIDGE_PAGE);
+#ifdef BENCHMARKS
+    InitialiseButton(BENCHMARK_RUN, 160, 205, 100, BLUE, "Run", false, BENCHMARK_PAGE);
+#endif
+#ifdef TRACE_ENABLED
+    InitialiseButton(TRACE_DUMP, 160, 205, 100, BLUE, "Dump", false, TRACE_PAGE);
+#endif
    
     
 	_delay_ms(100*16); // Wait for LCD to power up - for some reason delay function not recognising F_CPU
 	TFT_Init();
 
 	Touch_Init();
+	Touch_SetPrecision(8); // Fast coarse reads until a slider is being dragged
+
+	Link_Init();
+	Params_Init();
 
 	sei(); // Enable interrupts
 
 	while (1)
 	{
+		TRACE_BEGIN_FRAME();
+		if (buttonPressed != NONE) TRACE(TRACE_BUTTON, buttonPressed);
 		switch (buttonPressed)
         {
             case NONE:
@@ -270,72 +432,169 @@ int main(void)
                 break;
                 
             case RED_EYES:
-                Transmit('r');
+                Link_SendCommand('r');
                 SelectButton(RED_EYES, GREEN_EYES, BLUE_EYES);
                 break;
                 
             case GREEN_EYES:
-                Transmit('g');
+                Link_SendCommand('g');
                 SelectButton(GREEN_EYES, RED_EYES, BLUE_EYES);
                 break;
                 
             case BLUE_EYES:
-                Transmit('b');
+                Link_SendCommand('b');
                 SelectButton(BLUE_EYES, RED_EYES, GREEN_EYES);
                 break;
+                
+            case PARAMS_PREV:
+                if (paramsFirstRow >= PARAM_ROWS)
+                {
+                    paramsFirstRow -= PARAM_ROWS;
+                    RedrawPage();
+                }
+                break;
+                
+            case PARAMS_NEXT:
+                if (paramsFirstRow + PARAM_ROWS < paramCache.count)
+                {
+                    paramsFirstRow += PARAM_ROWS;
+                    RedrawPage();
+                }
+                break;
+                
+            case BRIDGE_START:
+                if (bridgeActive)
+                    Bridge_Stop();
+                else
+                {
+                    SendControl(512, 512, 512, 512); // Hexapod stands still rather than carrying on with the last command
+                    Bridge_Start();
+                    shownToRobot = 0;
+                    shownToPc = 0;
+                }
+                buttons[BRIDGE_START].text = bridgeActive ? "Stop" : "Start";
+                buttons[BRIDGE_START].selected = bridgeActive;
+                buttons[BRIDGE_START].needsRedraw = true;
+                break;
+#ifdef BENCHMARKS
+                
+            case BENCHMARK_RUN:
+                SendControl(512, 512, 512, 512); // Hexapod stands still, as it gets no commands for a few seconds
+                RunBenchmarks();
+                nextControlTime = Timebase_Micros(); // Rather than catching up on every period missed
+                RedrawPage();
+                break;
+#endif
+#ifdef TRACE_ENABLED
+                
+            case TRACE_DUMP:
+                Trace_Dump();
+                pageNeedsRefresh = true;
+                break;
+#endif
         }
         buttonPressed = NONE;
         
-        // Check for received bytes
-        if (UCSR1A & (1<<RXC1))
+        if (pageChangeRequested)
         {
-            int newHexapodSoC = UDR1;
-            if (newHexapodSoC < hexapodSoC) hexapodSoC = newHexapodSoC; // Expect to always go down, avoids jiggling
+            pageChangeRequested = false;
+            if (!bridgeActive) ChangePage((currentPage + 1) % NUM_PAGES); // Bridge page stays up until stopped
         }
         
-        while (ticks > 781) // 10Hz
+        if (chartChannelChangeRequested)
+        {
+            chartChannelChangeRequested = false;
+            Telemetry_SetChartChannel((telemetryChartChannel + 1) % NUM_TELEMETRY_CHANNELS);
+            displayNeedsFullRedraw = true;
+        }
+#ifdef ISR_PROFILING
+        
+        if (latencyIsrChangeRequested)
+        {
+            latencyIsrChangeRequested = false;
+            latencyIsr = (latencyIsr + 1) % NUM_PROFILED_ISRS;
+            displayNeedsFullRedraw = true;
+        }
+#endif
+        
+        if (bridgeActive)
+            Bridge_Poll();
+        else
+        {
+            // Check for received bytes
+            int newHexapodSoC = Link_Poll();
+            if (newHexapodSoC >= 0 && newHexapodSoC < hexapodSoC) hexapodSoC = newHexapodSoC; // Expect to always go down, avoids jiggling
+        }
+        
+        while (TIMEBASE_AFTER(Timebase_Micros(), nextControlTime)) // 10Hz
 		{
-			ticks -= 781;
+			nextControlTime += CONTROL_PERIOD;
+            
+            if (++pageRefreshCount >= 5)
+            {
+                pageRefreshCount = 0;
+                pageNeedsRefresh = true;
+                Telemetry_EndInterval();
+            }
            
             // Batt voltage via 10K:10K divider, 0-1023 ADC for 0-6.6V, works out 650 ADC for 4.2V, 500 ADC for 3.2V
-            int newControllerSoC = (ReadADC(V_BATT)-500)*2/3;
+            int newControllerSoC = FP_MulQ16Signed(ReadADC(V_BATT)-500, FP_Q16(2, 3));
             if (newControllerSoC < controllerSoC)
                 controllerSoC = newControllerSoC; // Always decreases, avoids jiggling due to sampling noise
-                    
-            left_x = ReadADC(LEFT_X)>>2; // Downsample to 8 bit
-            left_y = ReadADC(LEFT_Y)>>2;
-            right_x = ReadADC(RIGHT_X)>>2;
-            right_y = ReadADC(RIGHT_Y)>>2;
-            Transmit(joystick_command_character);
-            Transmit(controlBits);
-            Transmit(left_x);
-            Transmit(left_y);
-            Transmit(right_x);
-            Transmit(right_y);
-            Transmit(controlBits + left_x + left_y + right_x + right_y); // Basic checksum
+            
+            if (bridgeActive) continue; // The PC owns the radio
+            SendControl(ReadADC(LEFT_X), ReadADC(LEFT_Y), ReadADC(RIGHT_X), ReadADC(RIGHT_Y));
+#ifdef HIGH_RES_CONTROL
+            Params_Update(); // Robots on the original protocol have no parameter server either
+#endif
 		}
         
+        Params_SaveStep(); // Outside the control period, so a save never holds up control frames
+        
+        bool redrawing = displayNeedsFullRedraw;
+        if (redrawing) TRACE(TRACE_REDRAW_BEGIN, currentPage);
         switch (currentPage)
         {
             case MAIN_PAGE:
-                RenderMainPage(); // Only one page for Hexapod?
+                RenderMainPage();
+                break;
+            case PARAMS_PAGE:
+                RenderParamsPage();
+                break;
+            case TELEMETRY_PAGE:
+                RenderTelemetryPage();
+                break;
+            case BRIDGE_PAGE:
+                RenderBridgePage();
+                break;
+#ifdef ISR_PROFILING
+            case ISR_STATS_PAGE:
+                RenderIsrStatsPage();
+                break;
+            case LATENCY_PAGE:
+                RenderLatencyPage();
+                break;
+#endif
+#ifdef BENCHMARKS
+            case BENCHMARK_PAGE:
+                RenderBenchmarkPage();
                 break;
+#endif
+#ifdef TRACE_ENABLED
+            case TRACE_PAGE:
+                RenderTracePage();
+                break;
+#endif
         }
         RenderButtons();
         RenderSliders();
         displayNeedsFullRedraw = false;
+        if (redrawing) TRACE(TRACE_REDRAW_END, currentPage);
+        TRACE_END_FRAME();
 	}
     return 0; // Never gets here but compiler wants to see it
 }
 
-void Transmit(unsigned char c)
-{
-    while (( UCSR1A & (1<<UDRE1)) == 0); // Wait until TX buffer is empty (if needed)
-    UDR1 = c;// Putting data into buffer sends the data
-    while (( UCSR1A & (1<<UDRE1)) == 0);
-    _delay_ms(2); // Dirty hack, otherwise seems to be some bug with sending successive characters
-}
-
 void RenderMainPage()
 {
     if (displayNeedsFullRedraw)
@@ -355,22 +614,520 @@ void RenderMainPage()
     
     DrawBattery(200, 5, hexapodSoC);
     DrawBattery(276, 5, controllerSoC);
+    
+    // R for radio or T for tether, red if that link is currently failing
+    if (displayNeedsFullRedraw || shownLink != activeLink || shownLinkHealthy != links[activeLink].healthy)
+    {
+        shownLink = activeLink;
+        shownLinkHealthy = links[activeLink].healthy;
+        TFT_Text(activeLink == LINK_CAN ? "T" : "R", 162, 3, 1, shownLinkHealthy ? GREEN : RED, BLACK);
+    }
+}
+
+#ifdef ISR_PROFILING
+void RenderIsrStatsPage()
+{
+    if (displayNeedsFullRedraw)
+    {
+        TFT_Fill(BLACK);
+        TFT_Text("ISR timing (us)", 2, 3, 1, BLUE, BLACK);
+        TFT_Box(0, 24, 320, 25, L_GRAY);
+        TFT_Text("ISR     Mean    Max    Lat", 2, 30, 1, WHITE, BLACK);
+        TFT_Text("Tap here to reset", 2, 211, 1, L_GRAY, BLACK);
+        pageNeedsRefresh = true;
+    }
+    if (!pageNeedsRefresh) return;
+    pageNeedsRefresh = false;
+    
+    for (U8 n=0; n<NUM_PROFILED_ISRS; n++)
+    {
+        IsrProfile snapshot;
+        IsrProfile* profile = &snapshot;
+        Profiler_Snapshot(n, profile);
+        U16 mean = profile->count ? profile->totalTime/profile->count : 0;
+        // Timer3 counts are 0.5us, so halve and show the remainder as a decimal
+        if (Profiler_LatencyMeasured(profile))
+            sprintf(buffer, "%-6s%4u.%u%5u.%u%5u.%u", isrNames[n],
+                mean>>1, (mean&1)*5,
+                profile->maxTime>>1, (profile->maxTime&1)*5,
+                profile->maxLatency>>1, (profile->maxLatency&1)*5);
+        else
+            sprintf(buffer, "%-6s%4u.%u%5u.%u%7s", isrNames[n],
+                mean>>1, (mean&1)*5,
+                profile->maxTime>>1, (profile->maxTime&1)*5, "--");
+        TFT_Text(buffer, 2, 48 + n*16, 1, L_GRAY, BLACK);
+    }
+}
+
+void RenderLatencyPage()
+{
+    static const char* bucketNames[LATENCY_BUCKETS] = { "0", "1", "2-3", "4-7", "8-15", "16-31", "32-63", "64+" };
+    
+    if (displayNeedsFullRedraw)
+    {
+        TFT_Fill(BLACK);
+        sprintf(buffer, "%s latency (us)", isrNames[latencyIsr]);
+        TFT_Text(buffer, 2, 3, 1, BLUE, BLACK);
+        TFT_Box(0, 24, 320, 25, L_GRAY);
+        TFT_Text("Tap here for next ISR", 2, 211, 1, L_GRAY, BLACK);
+        pageNeedsRefresh = true;
+    }
+    if (!pageNeedsRefresh) return;
+    pageNeedsRefresh = false;
+    
+    IsrProfile profile;
+    Profiler_Snapshot(latencyIsr, &profile);
+    static bool shownMeasured = true;
+    bool measured = Profiler_LatencyMeasured(&profile);
+    if (measured != shownMeasured) TFT_Box(0, 30, 320, 207, BLACK); // Switching between the bars and the message
+    shownMeasured = measured;
+    if (!measured)
+    {
+        TFT_CentredText(profile.count ? "Not measured" : "Not run yet ", 160, 112, 1, L_GRAY, BLACK); // Same length
+        return;
+    }
+    U16 most = 1;
+    for (U8 n=0; n<LATENCY_BUCKETS; n++)
+        if (profile.latencyHistogram[n] > most) most = profile.latencyHistogram[n];
+    
+    for (U8 n=0; n<LATENCY_BUCKETS; n++)
+    {
+        U16 y = 32 + n*22;
+        U16 count = profile.latencyHistogram[n];
+        sprintf(buffer, "%-6s%5u", bucketNames[n], count);
+        TFT_Text(buffer, 2, y, 1, L_GRAY, BLACK);
+        U16 width = (U32)count*180/most; // Bars scaled to the fullest bucket
+        TFT_Box(136, y+2, 136+width, y+14, CYAN);
+        TFT_Box(136+width+1, y+2, 318, y+14, BLACK);
+    }
+}
+#endif
+
+void RenderParamsPage()
+{
+    // A completed fetch may have brought a different table
+    if (paramSyncState != shownParamState && paramSyncState == PARAMS_SYNCED) RedrawPage();
+    
+    if (displayNeedsFullRedraw)
+    {
+        TFT_Fill(BLACK);
+        TFT_Text("Settings", 2, 3, 1, BLUE, BLACK);
+        TFT_Box(0, 24, 320, 25, L_GRAY);
+        
+        if (paramsFirstRow >= paramCache.count) paramsFirstRow = 0; // Table got shorter
+        for (U8 row=0; row<PARAM_ROWS; row++)
+        {
+            U8 index = paramsFirstRow + row;
+            Slider* slider = &sliders[PARAM_SLIDER_1 + row];
+            if (index >= paramCache.count)
+            {
+                slider->page = NUM_PAGES; // Past the end of the table, so hide it
+                continue;
+            }
+            slider->page = PARAMS_PAGE;
+            slider->value = paramPercent[row] = Params_GetPercent(index);
+            TFT_Text(paramCache.params[index].name, 2, 32 + row*44, 1, WHITE, BLACK);
+            sprintf(buffer, "%-6d", paramCache.params[index].value);
+            TFT_Text(buffer, 2, 48 + row*44, 1, L_GRAY, BLACK);
+        }
+        shownParamState = 0xFF;
+    }
+    
+    if (shownParamState != paramSyncState || shownParamsFetched != paramsFetched)
+    {
+        shownParamState = paramSyncState;
+        shownParamsFetched = paramsFetched;
+        static const char* syncNames[] = { "No link", "Checking", "Fetching", "Synced" };
+        if (paramSyncState == PARAMS_FETCHING)
+            sprintf(buffer, "Fetching %u/%u  ", paramsFetched, paramCache.count);
+        else
+            sprintf(buffer, "%-14s", syncNames[paramSyncState]); // Padded to blank out a longer previous status
+        TFT_Text(buffer, 140, 3, 1, L_GRAY, BLACK);
+    }
+    
+    // Apply slider drags, which go out to the hexapod in the next control period. Drags before the table is synced
+    // are dropped, and the redraw once it is puts the sliders back.
+    if (paramSyncState != PARAMS_SYNCED) return;
+    for (U8 row=0; row<PARAM_ROWS; row++)
+    {
+        U8 index = paramsFirstRow + row;
+        Slider* slider = &sliders[PARAM_SLIDER_1 + row];
+        if (index >= paramCache.count || slider->value == paramPercent[row]) continue;
+        paramPercent[row] = slider->value;
+        Params_SetPercent(index, slider->value);
+        sprintf(buffer, "%-6d", paramCache.params[index].value);
+        TFT_Text(buffer, 2, 48 + row*44, 1, L_GRAY, BLACK);
+    }
+}
+
+void RenderTelemetryPage()
+{
+    if (displayNeedsFullRedraw)
+    {
+        TFT_Fill(BLACK);
+        TFT_Text(telemetryNames[telemetryChartChannel], 2, 3, 1, BLUE, BLACK);
+        TFT_Box(0, 24, 320, 25, L_GRAY);
+        TFT_Text("   Min   Mean    Max", 2, 30, 1, WHITE, BLACK);
+        TFT_Text("Tap here for next channel", 2, 211, 1, L_GRAY, BLACK);
+        pageNeedsRefresh = true;
+    }
+    if (!pageNeedsRefresh) return;
+    pageNeedsRefresh = false;
+    
+    TelemetryStats* latest = &telemetryLatest[telemetryChartChannel];
+    if (latest->count)
+        sprintf(buffer, "%6d %6d %6d", latest->min, latest->mean, latest->max);
+    else
+        sprintf(buffer, "    --     --     --");
+    TFT_Text(buffer, 2, 48, 1, L_GRAY, BLACK);
+    
+    // Scale to whatever the history spans, at least 1 unit so nothing divides by zero
+    S16 low = 0x7FFF, high = -0x7FFF;
+    for (U8 n=0; n<TELEMETRY_HISTORY; n++)
+    {
+        TelemetryStats* stats = &telemetryHistory[n];
+        if (!stats->count) continue;
+        if (stats->min < low) low = stats->min;
+        if (stats->max > high) high = stats->max;
+    }
+    if (high <= low) high = low + 1;
+    S32 range = (S32)high - low;
+    
+    // Each column is a bar from min to max with a tick at the mean, oldest on the left
+    for (U8 n=0; n<TELEMETRY_HISTORY; n++)
+    {
+        TelemetryStats* stats = &telemetryHistory[(telemetryHistoryHead + n) % TELEMETRY_HISTORY];
+        U16 x = n*8;
+        if (!stats->count)
+        {
+            TFT_Box(x, CHART_TOP, x+6, CHART_BOTTOM, BLACK);
+            continue;
+        }
+        U16 top = CHART_BOTTOM - ((S32)stats->max - low)*(CHART_BOTTOM - CHART_TOP)/range;
+        U16 bottom = CHART_BOTTOM - ((S32)stats->min - low)*(CHART_BOTTOM - CHART_TOP)/range;
+        U16 mean = CHART_BOTTOM - ((S32)stats->mean - low)*(CHART_BOTTOM - CHART_TOP)/range;
+        if (top > CHART_TOP) TFT_Box(x, CHART_TOP, x+6, top-1, BLACK);
+        TFT_Box(x, top, x+6, bottom, CYAN);
+        TFT_Box(x, mean, x+6, mean, WHITE);
+        if (bottom < CHART_BOTTOM) TFT_Box(x, bottom+1, x+6, CHART_BOTTOM, BLACK);
+    }
+}
+
+void RenderBridgePage()
+{
+    BridgeCounts counts;
+    Bridge_GetCounts(&counts);
+    
+    if (displayNeedsFullRedraw)
+    {
+        TFT_Fill(BLACK);
+        TFT_Text("PC bridge", 2, 3, 1, BLUE, BLACK);
+        TFT_Box(0, 24, 320, 25, L_GRAY);
+        TFT_Text("USART0 to the hexapod", 2, 36, 1, L_GRAY, BLACK);
+        TFT_Text("          B/s     Total", 2, 71, 1, WHITE, BLACK);
+        shownToRobot = counts.toRobot;
+        shownToPc = counts.toPc;
+        pageNeedsRefresh = true;
+    }
+    if (!pageNeedsRefresh) return;
+    pageNeedsRefresh = false;
+    
+    // Refreshes at 2Hz, so twice the bytes since last time is the rate
+    sprintf(buffer, "To robot%5lu%10lu", (counts.toRobot - shownToRobot)*2, counts.toRobot);
+    TFT_Text(buffer, 2, 99, 1, L_GRAY, BLACK);
+    sprintf(buffer, "To PC   %5lu%10lu", (counts.toPc - shownToPc)*2, counts.toPc);
+    TFT_Text(buffer, 2, 127, 1, L_GRAY, BLACK);
+    sprintf(buffer, "Dropped %u", counts.dropped);
+    TFT_Text(buffer, 2, 155, 1, counts.dropped ? RED : L_GRAY, BLACK);
+    shownToRobot = counts.toRobot;
+    shownToPc = counts.toPc;
+}
+
+#ifdef BENCHMARKS
+void RenderBenchmarkPage()
+{
+    if (!displayNeedsFullRedraw) return; // Results only change by running them, which redraws the page
+    
+    TFT_Fill(BLACK);
+    TFT_Text("Benchmarks", 2, 3, 1, BLUE, BLACK);
+    TFT_Text(__DATE__, 318 - 11*12, 3, 1, L_GRAY, BLACK);
+    TFT_Box(0, 24, 320, 25, L_GRAY);
+    for (U8 n=0; n<NUM_BENCHMARKS; n++)
+    {
+        if (benchResults[n])
+            snprintf(buffer, sizeof(buffer), "%-9s%9lu %s", benchNames[n], benchResults[n], benchUnits[n]);
+        else
+            sprintf(buffer, "%-9s%9s", benchNames[n], "--");
+        TFT_Text(buffer, 2, 28 + n*16, 1, L_GRAY, BLACK);
+    }
+}
+
+// Runs in the main loop with the touch poll stopped, but the backlight and timebase interrupts still running as
+// they always are, so the times include their share
+void RunBenchmarks()
+{
+    const U8 repeats = 8;
+    U32 start;
+    
+    TIMSK1 &= ~(1<<TOIE1); // Touch_Read would fight the touch poll for the controller
+    
+    start = Timebase_Micros();
+    for (U8 n=0; n<repeats/2; n++) TFT_Fill(BLACK); // About a frame each, so fewer of these
+    benchResults[BENCH_FILL] = (Timebase_Micros() - start) / (repeats/2);
+    
+    for (U8 scale=1; scale<=3; scale++)
+    {
+        start = Timebase_Micros();
+        for (U8 n=0; n<repeats; n++) TFT_Text("01234567", 2, 40*scale, scale, WHITE, BLACK);
+        benchResults[BENCH_TEXT_1 + scale-1] = (Timebase_Micros() - start) / repeats;
+    }
+    
+    start = Timebase_Micros();
+    for (U8 n=0; n<repeats; n++)
+    {
+        buttons[BENCHMARK_RUN].needsRedraw = true;
+        RenderButtons();
+    }
+    benchResults[BENCH_BUTTON] = (Timebase_Micros() - start) / repeats;
+    
+    start = Timebase_Micros();
+    for (U8 n=0; n<repeats*2; n++)
+    {
+        for (U8 channel=V_BATT; channel<=RIGHT_Y; channel++) ReadADC(channel);
+    }
+    benchResults[BENCH_ADC] = repeats*2*1000000UL / (Timebase_Micros() - start);
+    
+    benchResults[BENCH_UART] = BenchmarkUart();
+    
+    benchResults[BENCH_MATH_DIVIDE] = BenchmarkTouchMath(BENCH_MATH_DIVIDE);
+    benchResults[BENCH_MATH_RECIPROCAL] = BenchmarkTouchMath(BENCH_MATH_RECIPROCAL);
+    
+    // Without a finger down there's nothing to convert, so Touch_Read would return almost at once
+    TFT_Fill(BLACK);
+    TFT_CentredText("Touch and hold", 160, 112, 1, WHITE, BLACK);
+    benchResults[BENCH_TOUCH_8] = 0;
+    benchResults[BENCH_TOUCH_12] = 0;
+    start = Timebase_Micros();
+    while (!Touch_DataAvailable() && Timebase_Micros() - start < BENCH_TOUCH_WAIT);
+    if (Touch_DataAvailable())
+    {
+        for (U8 precision=8; precision<=12; precision+=4)
+        {
+            Touch_SetPrecision(precision);
+            start = Timebase_Micros();
+            for (U8 n=0; n<repeats; n++) Touch_ReadBlocking();
+            benchResults[precision == 8 ? BENCH_TOUCH_8 : BENCH_TOUCH_12] = (Timebase_Micros() - start) / repeats;
+        }
+        Touch_SetPrecision(8);
+        TFT_CentredText("   Release    ", 160, 112, 1, WHITE, BLACK);
+        start = Timebase_Micros();
+        while (Touch_DataAvailable() && Timebase_Micros() - start < BENCH_TOUCH_WAIT); // So it isn't taken as a tap
+    }
+    
+    TIFR1 = (1<<TOV1); // Writing one clears it, so a poll due while stopped doesn't run the moment we restart
+    TIMSK1 |= (1<<TOIE1);
+    
+    // Logged as CSV for comparing handsets and builds
+    DebugUart_Start(DEBUG_UART_LOG_UBRR, (1<<TXEN0));
+    DebugUart_SendText("Built," __DATE__ " " __TIME__ ","
+#if defined(TFT_ILI9341)
+        " TFT_ILI9341"
+#elif defined(TFT_SSD1289)
+        " TFT_SSD1289"
+#elif defined(TFT_ILI9325)
+        " TFT_ILI9325"
+#endif
+#ifdef ROTATE180
+        " ROTATE180"
+#endif
+#ifdef FONT_SUBSET
+        " FONT_SUBSET"
+#endif
+#ifdef TOUCH_HW_SPI
+        " TOUCH_HW_SPI"
+#endif
+#ifdef HIGH_RES_CONTROL
+        " HIGH_RES_CONTROL"
+#endif
+#ifdef CAN_TETHER
+        " CAN_TETHER"
+#endif
+#ifdef ISR_PROFILING
+        " ISR_PROFILING"
+#endif
+#ifdef TRACE_ENABLED
+        " TRACE_ENABLED"
+#endif
+        "\r\n");
+    for (U8 n=0; n<NUM_BENCHMARKS; n++)
+    {
+        if (benchResults[n])
+            snprintf(buffer, sizeof(buffer), "%s,%lu,%s\r\n", benchNames[n], benchResults[n], benchUnits[n]);
+        else
+            sprintf(buffer, "%s,,%s\r\n", benchNames[n], benchUnits[n]);
+        DebugUart_SendText(buffer);
+    }
+    DebugUart_Flush();
+    DebugUart_Stop();
+}
+
+// Keeps a byte in flight both ways, so it's the UART's throughput rather than its round trip. Needs TXD0 (PE1)
+// wired to RXD0 (PE0), and gives 0 if any byte fails to come back intact.
+U32 BenchmarkUart()
+{
+    DebugUart_Start(BENCH_UART_UBRR, (1<<RXEN0) | (1<<TXEN0)); // Not DebugUart_Send, which would wait a byte at a time
+    while (UCSR0A & (1<<RXC0)) (void)UDR0; // Flush anything left over
+    
+    U8 sent = 0, received = 0;
+    bool intact = true;
+    U32 start = Timebase_Micros();
+    U32 lastByteTime = start;
+    while (received < BENCH_UART_BYTES && Timebase_Micros() - lastByteTime < BENCH_UART_TIMEOUT)
+    {
+        if (sent < BENCH_UART_BYTES && (UCSR0A & (1<<UDRE0))) UDR0 = sent++;
+        if (UCSR0A & (1<<RXC0))
+        {
+            if (UDR0 != received++) intact = false;
+            lastByteTime = Timebase_Micros();
+        }
+    }
+    U32 time = Timebase_Micros() - start;
+    DebugUart_Stop();
+    
+    if (received < BENCH_UART_BYTES || !intact) return 0;
+    return BENCH_UART_BYTES*1000000UL / time;
+}
+
+// Cycles for one each of Touch_GetX, Touch_GetY and the slider percentage from HandleTouchDown, just the scaling
+// arithmetic without the clamping around it. The divisions are kept here as they were before FixedPoint.h, so the
+// saving can be measured rather than estimated. A loop doing only the volatile reads and writes is taken off.
+U32 BenchmarkTouchMath(U8 benchmark)
+{
+    volatile U16 rawX = 2000, rawY = 2000; // Mid screen, volatile so nothing folds at compile time
+    volatile int offset = 120;
+    volatile int result;
+    Slider* slider = &sliders[PARAM_SLIDER_1];
+    
+    U32 start = Timebase_Micros();
+    for (U16 n=0; n<BENCH_MATH_REPEATS; n++)
+    {
+        result = rawX;
+        result = rawY;
+        result = offset;
+    }
+    U32 overhead = Timebase_Micros() - start;
+    
+    start = Timebase_Micros();
+    for (U16 n=0; n<BENCH_MATH_REPEATS; n++)
+    {
+        if (benchmark == BENCH_MATH_DIVIDE)
+        {
+            int usableWidth = slider->width-16;
+            result = (rawX-150) * 8 / 95;
+            result = (rawY-200) * 6 / 92;
+            result = 100*offset/usableWidth;
+        }
+        else
+        {
+            result = FP_MulQ16(rawX-150, FP_Q16(8, 95));
+            result = FP_MulQ16(rawY-200, FP_Q16(6, 92));
+            result = FP_MulQ8(offset, slider->percentPerPixel);
+        }
+    }
+    U32 time = Timebase_Micros() - start;
+    (void)result;
+    
+    if (time <= overhead) return 0;
+    return (time - overhead) * 16 / BENCH_MATH_REPEATS;
+}
+#endif
+
+#ifdef TRACE_ENABLED
+void RenderTracePage()
+{
+    if (displayNeedsFullRedraw)
+    {
+        TFT_Fill(BLACK);
+        TFT_Text("Event trace", 2, 3, 1, BLUE, BLACK);
+        TFT_Box(0, 24, 320, 25, L_GRAY);
+        TFT_Text("Dumps out of USART0", 2, 36, 1, L_GRAY, BLACK);
+        TFT_Text("at 38400 baud", 2, 64, 1, L_GRAY, BLACK);
+        pageNeedsRefresh = true;
+    }
+    if (!pageNeedsRefresh) return;
+    pageNeedsRefresh = false;
+    
+    U16 count;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        count = traceCount;
+    }
+    sprintf(buffer, "Recorded%7u", count);
+    TFT_Text(buffer, 2, 99, 1, L_GRAY, BLACK);
+    sprintf(buffer, "Kept    %7u", count < TRACE_RECORDS ? count : TRACE_RECORDS);
+    TFT_Text(buffer, 2, 127, 1, L_GRAY, BLACK);
+    if (traceFrozenFrame)
+        sprintf(buffer, "Frozen on %5ums", traceFrozenFrame);
+    else
+        sprintf(buffer, "%-16s", "Recording");
+    TFT_Text(buffer, 2, 155, 1, L_GRAY, BLACK);
+}
+#endif
+
+void ChangePage(U8 page)
+{
+    if (page == currentPage) return;
+    if (currentPage == PARAMS_PAGE) Params_Save(); // Once per visit rather than per edit, to spare the EEPROM
+    currentPage = page;
+    RedrawPage();
+}
+
+void RedrawPage()
+{
+    displayNeedsFullRedraw = true;
+    for (U8 n=0; n<NUM_BUTTONS; n++) buttons[n].needsRedraw = true;
+    for (U8 n=0; n<NUM_SLIDERS; n++) sliders[n].oldValue = -1;
+}
+
+void SendControl(U16 leftX, U16 leftY, U16 rightX, U16 rightY)
+{
+#ifdef HIGH_RES_CONTROL
+    ControlMsg control = { controlBits, leftX, leftY, rightX, rightY };
+    Link_SendControl(&control);
+#else
+    left_x = leftX>>2; // Downsample to 8 bit
+    left_y = leftY>>2;
+    right_x = rightX>>2;
+    right_y = rightY>>2;
+    Transmit(joystick_command_character);
+    Transmit(controlBits);
+    Transmit(left_x);
+    Transmit(left_y);
+    Transmit(right_x);
+    Transmit(right_y);
+    Transmit(controlBits + left_x + left_y + right_x + right_y); // Basic checksum
+#endif
 }
 
 void HandleTouchDown()
 {
 	touchX = Touch_GetX();
 	touchY = Touch_GetY();
+	TRACE(TRACE_TOUCH_DOWN, touchX);
 
-	if (touchTimer == 3)
+	if (!touchAccepted)
 	{
+        if (Timebase_Micros() - touchDownTime < TOUCH_SETTLE_TIME) return;
+        touchAccepted = true;
+        
         for (U8 n=0; n<NUM_BUTTONS; n++)
             if (ButtonTouched(&buttons[n])) touchedButton = n;
        
         for (U8 n=0; n<NUM_SLIDERS; n++)
             if (SliderTouched(&sliders[n])) touchedSlider = n;
+        if (touchedSlider != NONE) Touch_SetPrecision(12); // Full resolution for the drag
 	}
-    else if (touchTimer > 3) // could be dragging a slider
+    else // could be dragging a slider
     {
         for (U8 n=0; n<NUM_SLIDERS; n++)
         {
@@ -378,9 +1135,10 @@ void HandleTouchDown()
             if (SliderTouched(&sliders[n]) && touchedSlider == n)
             {
                 int usableWidth = slider->width-16;
-                slider->value = 100*(touchX - (slider->x-usableWidth/2))/usableWidth; // Get a percentage
-                if (slider->value < 0) slider->value = 0;
-                if (slider->value > 100) slider->value = 100;
+                int offset = touchX - (slider->x-usableWidth/2);
+                if (offset < 0) offset = 0;
+                U16 value = FP_MulQ8(offset, slider->percentPerPixel); // Get a percentage
+                slider->value = value > 100 ? 100 : value;
             }
         }
     }
@@ -388,12 +1146,25 @@ void HandleTouchDown()
 
 void HandleTouchUp()
 {
-	if (touchTimer < 3) return; // Ignore too-fast touches
+	if (!touchAccepted) return; // Ignore too-fast touches
+	TRACE(TRACE_TOUCH_UP, touchX);
+
+    if (touchY < 24) // Title bar steps through the hidden pages
+        pageChangeRequested = true;
+    else if (currentPage == TELEMETRY_PAGE)
+        chartChannelChangeRequested = true;
+#ifdef ISR_PROFILING
+    else if (currentPage == ISR_STATS_PAGE)
+        Profiler_Reset();
+    else if (currentPage == LATENCY_PAGE)
+        latencyIsrChangeRequested = true;
+#endif
 
     if (ButtonTouched(&buttons[touchedButton])) // Only accept if finger still within button area
         buttonPressed = touchedButton; // TODO: Ambiguous variable names?
 	touchedButton = NONE;
     touchedSlider = NONE;
+    Touch_SetPrecision(8);
 }
 
 void SetupPorts()
@@ -406,7 +1177,7 @@ void SetupPorts()
 	DDRG |= RST;
 	DDRD |= RS + CS + WR; // RD not used
 
-	// Timer0 used for ticks and display backlight PWM
+	// Timer0 used for display backlight PWM
 	TCCR0A = (1<<CS01) /* + (1<<WGM01) + (1<<WGM00) + (1<<COM0A1) */ ; // clk/8 counting rate = 1Mhz, overflows at 7812Hz, PWM OFF - was fast PWM, non inverting
 	TIMSK0 = (1<<TOIE0) + (1<<OCIE0A); // Interrupt on overflow and output compare
 
@@ -428,6 +1199,7 @@ void SetupPorts()
     ADMUX = (1<<REFS0); // AVCC reference, capacitor on AREF pin
     ADCSRA = 0b10000111; // ADEN plus prescaler bits 111 = /128 (gives 125kHz ADC clock, needs to be 50-200kHz)
     
+    Timebase_Init(); // Timer3, also the ISR profiling timestamp
 }
 
 int ReadADC(unsigned char channel)
@@ -440,7 +1212,7 @@ int ReadADC(unsigned char channel)
 	return ADCW;
 }
 
-void InitialiseButton(U8 button, U16 x, U16 y, U16 width, U16 colour, const char* text, U8 selected)
+void InitialiseButton(U8 button, U16 x, U16 y, U16 width, U16 colour, const char* text, U8 selected, U8 page)
 {
     Button* buttonPointer = &buttons[button];
     buttonPointer->x = x;
@@ -451,7 +1223,7 @@ void InitialiseButton(U8 button, U16 x, U16 y, U16 width, U16 colour, const char
     buttonPointer->highlighted = false;
     buttonPointer->selected = selected;
     buttonPointer->needsRedraw = true;
-    buttonPointer->page = MAIN_PAGE; // Hexapod controller is single page display
+    buttonPointer->page = page;
 }
 
 void SelectButton(S8 newButton, S8 oldButton, S8 otherOldButton)
@@ -477,6 +1249,10 @@ void InitialiseSlider(U8 slider, U16 x, U16 y, U16 width, U16 colour, S8 value,
     sliderPointer->value = value;
     sliderPointer->oldValue = -1; // Force initial redraw
     sliderPointer->page = page;    
+    
+    U16 usableWidth = width-16;
+    sliderPointer->percentPerPixel = ((100<<8) + usableWidth/2) / usableWidth;
+    sliderPointer->pixelsPerPercent = ((U32)usableWidth*256 + 50) / 100;
 }
 
 inline void RenderBorderBox(int lx, int ly, int rx, int ry, U16 Fcolor, U16 colour)
@@ -518,7 +1294,7 @@ void RenderSliders()
         if (slider->page == currentPage && slider->oldValue != slider->value)
         {
             int usableWidth = slider->width-16;
-            int middle = slider->x-usableWidth/2+usableWidth*slider->value/100;
+            int middle = slider->x-usableWidth/2+FP_MulQ8(slider->value, slider->pixelsPerPercent);
             
             TFT_Box(slider->x-slider->width/2, slider->y, slider->x+slider->width/2, slider->y+8, BLACK);
             TFT_Box(slider->x-slider->width/2, slider->y+8, slider->x+slider->width/2, slider->y+24, D_GRAY);
@@ -543,7 +1319,7 @@ void DrawBattery(int x, int y, int percentage)
     else if (percentage < 50)
         colour = YELLOW;
     
-    int width = percentage*30/100;
+    int width = FP_MulQ16Signed(percentage, FP_Q16(30, 100));
     if (width<3) width = 3; // Show bit of red even when flat
     
     TFT_Box(x+2, y+2, x+2+width, y+10, colour);
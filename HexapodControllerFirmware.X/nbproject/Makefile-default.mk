@@ -51,17 +51,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=main.c Touchscreen.c
+SOURCEFILES_QUOTED_IF_SPACED=main.c Touchscreen.c Profiler.c Can.c Link.c Params.c Bridge.c Timebase.c Trace.c Telemetry.c DebugUart.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/main.o ${OBJECTDIR}/Touchscreen.o
-POSSIBLE_DEPFILES=${OBJECTDIR}/main.o.d ${OBJECTDIR}/Touchscreen.o.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/main.o ${OBJECTDIR}/Touchscreen.o ${OBJECTDIR}/Profiler.o ${OBJECTDIR}/Can.o ${OBJECTDIR}/Link.o ${OBJECTDIR}/Params.o ${OBJECTDIR}/Bridge.o ${OBJECTDIR}/Timebase.o ${OBJECTDIR}/Trace.o ${OBJECTDIR}/Telemetry.o ${OBJECTDIR}/DebugUart.o
+POSSIBLE_DEPFILES=${OBJECTDIR}/main.o.d ${OBJECTDIR}/Touchscreen.o.d ${OBJECTDIR}/Profiler.o.d ${OBJECTDIR}/Can.o.d ${OBJECTDIR}/Link.o.d ${OBJECTDIR}/Params.o.d ${OBJECTDIR}/Bridge.o.d ${OBJECTDIR}/Timebase.o.d ${OBJECTDIR}/Trace.o.d ${OBJECTDIR}/Telemetry.o.d ${OBJECTDIR}/DebugUart.o.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/main.o ${OBJECTDIR}/Touchscreen.o
+OBJECTFILES=${OBJECTDIR}/main.o ${OBJECTDIR}/Touchscreen.o ${OBJECTDIR}/Profiler.o ${OBJECTDIR}/Can.o ${OBJECTDIR}/Link.o ${OBJECTDIR}/Params.o ${OBJECTDIR}/Bridge.o ${OBJECTDIR}/Timebase.o ${OBJECTDIR}/Trace.o ${OBJECTDIR}/Telemetry.o ${OBJECTDIR}/DebugUart.o
 
 # Source Files
-SOURCEFILES=main.c Touchscreen.c
+SOURCEFILES=main.c Touchscreen.c Profiler.c Can.c Link.c Params.c Bridge.c Timebase.c Trace.c Telemetry.c DebugUart.c
 
 
 
@@ -100,6 +100,60 @@ ${OBJECTDIR}/Touchscreen.o: Touchscreen.c  nbproject/Makefile-${CND_CONF}.mk
 	@${RM} ${OBJECTDIR}/Touchscreen.o 
 	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -DF_CPU=16000000UL -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/Touchscreen.o.d" -MT "${OBJECTDIR}/Touchscreen.o.d" -MT ${OBJECTDIR}/Touchscreen.o -o ${OBJECTDIR}/Touchscreen.o Touchscreen.c 
 	
+${OBJECTDIR}/DebugUart.o: DebugUart.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/DebugUart.o.d 
+	@${RM} ${OBJECTDIR}/DebugUart.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -DF_CPU=16000000UL -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/DebugUart.o.d" -MT "${OBJECTDIR}/DebugUart.o.d" -MT ${OBJECTDIR}/DebugUart.o -o ${OBJECTDIR}/DebugUart.o DebugUart.c 
+	
+${OBJECTDIR}/Telemetry.o: Telemetry.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/Telemetry.o.d 
+	@${RM} ${OBJECTDIR}/Telemetry.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -DF_CPU=16000000UL -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/Telemetry.o.d" -MT "${OBJECTDIR}/Telemetry.o.d" -MT ${OBJECTDIR}/Telemetry.o -o ${OBJECTDIR}/Telemetry.o Telemetry.c 
+	
+${OBJECTDIR}/Trace.o: Trace.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/Trace.o.d 
+	@${RM} ${OBJECTDIR}/Trace.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -DF_CPU=16000000UL -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/Trace.o.d" -MT "${OBJECTDIR}/Trace.o.d" -MT ${OBJECTDIR}/Trace.o -o ${OBJECTDIR}/Trace.o Trace.c 
+	
+${OBJECTDIR}/Timebase.o: Timebase.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/Timebase.o.d 
+	@${RM} ${OBJECTDIR}/Timebase.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -DF_CPU=16000000UL -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/Timebase.o.d" -MT "${OBJECTDIR}/Timebase.o.d" -MT ${OBJECTDIR}/Timebase.o -o ${OBJECTDIR}/Timebase.o Timebase.c 
+	
+${OBJECTDIR}/Bridge.o: Bridge.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/Bridge.o.d 
+	@${RM} ${OBJECTDIR}/Bridge.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -DF_CPU=16000000UL -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/Bridge.o.d" -MT "${OBJECTDIR}/Bridge.o.d" -MT ${OBJECTDIR}/Bridge.o -o ${OBJECTDIR}/Bridge.o Bridge.c 
+	
+${OBJECTDIR}/Params.o: Params.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/Params.o.d 
+	@${RM} ${OBJECTDIR}/Params.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -DF_CPU=16000000UL -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/Params.o.d" -MT "${OBJECTDIR}/Params.o.d" -MT ${OBJECTDIR}/Params.o -o ${OBJECTDIR}/Params.o Params.c 
+	
+${OBJECTDIR}/Link.o: Link.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/Link.o.d 
+	@${RM} ${OBJECTDIR}/Link.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -DF_CPU=16000000UL -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/Link.o.d" -MT "${OBJECTDIR}/Link.o.d" -MT ${OBJECTDIR}/Link.o -o ${OBJECTDIR}/Link.o Link.c 
+	
+${OBJECTDIR}/Can.o: Can.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/Can.o.d 
+	@${RM} ${OBJECTDIR}/Can.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -DF_CPU=16000000UL -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/Can.o.d" -MT "${OBJECTDIR}/Can.o.d" -MT ${OBJECTDIR}/Can.o -o ${OBJECTDIR}/Can.o Can.c 
+	
+${OBJECTDIR}/Profiler.o: Profiler.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/Profiler.o.d 
+	@${RM} ${OBJECTDIR}/Profiler.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -DF_CPU=16000000UL -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/Profiler.o.d" -MT "${OBJECTDIR}/Profiler.o.d" -MT ${OBJECTDIR}/Profiler.o -o ${OBJECTDIR}/Profiler.o Profiler.c 
+	
 else
 ${OBJECTDIR}/main.o: main.c  nbproject/Makefile-${CND_CONF}.mk 
 	@${MKDIR} "${OBJECTDIR}" 
@@ -113,6 +167,60 @@ ${OBJECTDIR}/Touchscreen.o: Touchscreen.c  nbproject/Makefile-${CND_CONF}.mk
 	@${RM} ${OBJECTDIR}/Touchscreen.o 
 	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -DF_CPU=16000000UL -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/Touchscreen.o.d" -MT "${OBJECTDIR}/Touchscreen.o.d" -MT ${OBJECTDIR}/Touchscreen.o -o ${OBJECTDIR}/Touchscreen.o Touchscreen.c 
 	
+${OBJECTDIR}/DebugUart.o: DebugUart.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/DebugUart.o.d 
+	@${RM} ${OBJECTDIR}/DebugUart.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -DF_CPU=16000000UL -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/DebugUart.o.d" -MT "${OBJECTDIR}/DebugUart.o.d" -MT ${OBJECTDIR}/DebugUart.o -o ${OBJECTDIR}/DebugUart.o DebugUart.c 
+	
+${OBJECTDIR}/Telemetry.o: Telemetry.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/Telemetry.o.d 
+	@${RM} ${OBJECTDIR}/Telemetry.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -DF_CPU=16000000UL -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/Telemetry.o.d" -MT "${OBJECTDIR}/Telemetry.o.d" -MT ${OBJECTDIR}/Telemetry.o -o ${OBJECTDIR}/Telemetry.o Telemetry.c 
+	
+${OBJECTDIR}/Trace.o: Trace.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/Trace.o.d 
+	@${RM} ${OBJECTDIR}/Trace.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -DF_CPU=16000000UL -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/Trace.o.d" -MT "${OBJECTDIR}/Trace.o.d" -MT ${OBJECTDIR}/Trace.o -o ${OBJECTDIR}/Trace.o Trace.c 
+	
+${OBJECTDIR}/Timebase.o: Timebase.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/Timebase.o.d 
+	@${RM} ${OBJECTDIR}/Timebase.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -DF_CPU=16000000UL -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/Timebase.o.d" -MT "${OBJECTDIR}/Timebase.o.d" -MT ${OBJECTDIR}/Timebase.o -o ${OBJECTDIR}/Timebase.o Timebase.c 
+	
+${OBJECTDIR}/Bridge.o: Bridge.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/Bridge.o.d 
+	@${RM} ${OBJECTDIR}/Bridge.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -DF_CPU=16000000UL -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/Bridge.o.d" -MT "${OBJECTDIR}/Bridge.o.d" -MT ${OBJECTDIR}/Bridge.o -o ${OBJECTDIR}/Bridge.o Bridge.c 
+	
+${OBJECTDIR}/Params.o: Params.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/Params.o.d 
+	@${RM} ${OBJECTDIR}/Params.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -DF_CPU=16000000UL -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/Params.o.d" -MT "${OBJECTDIR}/Params.o.d" -MT ${OBJECTDIR}/Params.o -o ${OBJECTDIR}/Params.o Params.c 
+	
+${OBJECTDIR}/Link.o: Link.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/Link.o.d 
+	@${RM} ${OBJECTDIR}/Link.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -DF_CPU=16000000UL -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/Link.o.d" -MT "${OBJECTDIR}/Link.o.d" -MT ${OBJECTDIR}/Link.o -o ${OBJECTDIR}/Link.o Link.c 
+	
+${OBJECTDIR}/Can.o: Can.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/Can.o.d 
+	@${RM} ${OBJECTDIR}/Can.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -DF_CPU=16000000UL -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/Can.o.d" -MT "${OBJECTDIR}/Can.o.d" -MT ${OBJECTDIR}/Can.o -o ${OBJECTDIR}/Can.o Can.c 
+	
+${OBJECTDIR}/Profiler.o: Profiler.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/Profiler.o.d 
+	@${RM} ${OBJECTDIR}/Profiler.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -DF_CPU=16000000UL -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/Profiler.o.d" -MT "${OBJECTDIR}/Profiler.o.d" -MT ${OBJECTDIR}/Profiler.o -o ${OBJECTDIR}/Profiler.o Profiler.c 
+	
 endif
 
 # ------------------------------------------------------------------------------------
@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+# fontsubset.py
+# Builds FontSubset.h, holding only the FONT_16x16 glyphs the firmware can actually draw, plus a remap table from
+# character to glyph index. Run by the .build-pre step of the firmware Makefile, e.g.
+#   python3 ../Tools/fontsubset.py --chars "0123456789" -o FontSubset.h *.c
+# Characters come from every string literal in the given sources (printf conversions are skipped, so their output
+# needs declaring with --chars), plus the --chars set for text that only exists at run time.
+
+import argparse
+import re
+import sys
+
+FIRST_CHAR = 32
+NUM_CHARS = 95
+GLYPH_BYTES = 32
+FALLBACK = '?' # Drawn for any character left out of the subset
+
+STRING = re.compile(r'"((?:[^"\\\n]|\\.)*)"')
+COMMENT = re.compile(r'//[^\n]*|/\*.*?\*/', re.S)
+CONVERSION = re.compile(r'%[-+ #0]*(\d+|\*)?(\.\d+)?[hlL]*[diouxXcsfeEgGp]')
+ESCAPES = {'n': '\n', 't': '\t', 'r': '\r', '0': '\0', '\\': '\\', '"': '"', "'": "'"}
+
+
+def literal_chars(source):
+    # Comments go first so quotes in them don't count, then #include lines as their paths are never drawn
+    source = COMMENT.sub('', source)
+    source = '\n'.join(line for line in source.split('\n') if not line.lstrip().startswith('#include'))
+    chars = set()
+    for match in STRING.finditer(source):
+        text = re.sub(r'\\(.)', lambda m: ESCAPES.get(m.group(1), m.group(1)), match.group(1))
+        text = CONVERSION.sub('', text).replace('%%', '%')
+        chars.update(c for c in text if FIRST_CHAR <= ord(c) < FIRST_CHAR + NUM_CHARS)
+    return chars
+
+
+def read_glyphs(path):
+    # One line of 32 hex bytes per glyph, in character order from space
+    glyphs = []
+    for line in open(path):
+        data, _, comment = line.partition('//')
+        values = re.findall(r'0x[0-9A-Fa-f]{2}', data)
+        if len(values) == GLYPH_BYTES:
+            glyphs.append((','.join(values), comment.strip()))
+    if len(glyphs) != NUM_CHARS:
+        sys.exit('%s: expected %d glyphs, found %d' % (path, NUM_CHARS, len(glyphs)))
+    return glyphs
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Subset FONT_16x16 to the characters the UI uses')
+    parser.add_argument('sources', nargs='+', help='C sources to scan for string literals')
+    parser.add_argument('--chars', default='', help='extra characters drawn at run time, e.g. digits')
+    parser.add_argument('--font', default='Fonts.h')
+    parser.add_argument('-o', '--output', default='FontSubset.h')
+    args = parser.parse_args()
+
+    chars = set(args.chars) | {' ', FALLBACK}
+    for path in args.sources:
+        chars |= literal_chars(open(path).read())
+    chars = sorted(chars)
+
+    glyphs = read_glyphs(args.font)
+    index = {c: n for n, c in enumerate(chars)}
+    remap = [index.get(chr(FIRST_CHAR + n), index[FALLBACK]) for n in range(NUM_CHARS)]
+
+    out = []
+    out.append('// FontSubset.h')
+    out.append('// Generated by Tools/fontsubset.py from %s, do not edit' % args.font)
+    out.append('// %d of %d glyphs, %d bytes instead of %d' % (len(chars), NUM_CHARS,
+               len(chars)*GLYPH_BYTES + NUM_CHARS, NUM_CHARS*GLYPH_BYTES))
+    out.append('')
+    out.append('#define FONT_SUBSET_GLYPHS %d' % len(chars))
+    out.append('')
+    out.append("// Glyph for each character from space, anything not in the subset draws as '%s'" % FALLBACK)
+    out.append('const unsigned char FONT_REMAP[%d] PROGMEM = {' % NUM_CHARS)
+    for row in range(0, NUM_CHARS, 16):
+        out.append('    ' + ','.join('%2d' % n for n in remap[row:row+16]) + ',')
+    out[-1] = out[-1].rstrip(',')
+    out.append('};')
+    out.append('')
+    out.append('const char FONT_16x16_SUBSET[%d] PROGMEM = {' % (len(chars)*GLYPH_BYTES))
+    for n, c in enumerate(chars):
+        data, comment = glyphs[ord(c) - FIRST_CHAR]
+        out.append('    %s%s // %s' % (data, ',' if n < len(chars)-1 else ' ', comment))
+    out.append('};')
+
+    text = '\n'.join(out) + '\n'
+    try:
+        if open(args.output).read() == text:
+            return # Unchanged, so leave the timestamp alone and don't force a rebuild
+    except IOError:
+        pass
+    open(args.output, 'w').write(text)
+
+
+if __name__ == '__main__':
+    main()
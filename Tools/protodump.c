@@ -0,0 +1,53 @@
+// protodump.c
+// Decodes a captured controller <-> hexapod byte stream into one line per message, e.g.
+//   cat /dev/ttyUSB0 | ./protodump
+// Build: cc -O2 -o protodump protodump.c -I../HexapodControllerFirmware.X
+// Message names and fields come from ProtocolSchema.h, so this never needs editing when the protocol changes.
+
+#include <stdio.h>
+
+#include "Protocol.h"
+
+#define PRINT_FIELD(ctype, name, bits) printf(" %s=%u", #name, (unsigned)msg.name);
+
+#define PRINT_MESSAGE(Name, id, FIELDS) \
+    case (id): \
+    { \
+        Name##Msg msg; \
+        if (!Name##Msg_Decode(frame, &msg)) { printf("%s bad checksum\n", #Name); break; } \
+        printf("%s", #Name); \
+        FIELDS(PRINT_FIELD) \
+        printf("\n"); \
+        break; \
+    }
+
+int main(void)
+{
+    uint8_t frame[PROTOCOL_MAX_LENGTH];
+    uint8_t received = 0, length = 0;
+    int c;
+
+    while ((c = getchar()) != EOF)
+    {
+        if (length == 0) // Between frames
+        {
+            length = Protocol_FrameLength(c);
+            if (length == 0)
+            {
+                printf("Byte 0x%02X '%c'\n", c, (c >= 32 && c < 127) ? c : '.'); // Legacy single byte command or status
+                continue;
+            }
+            received = 0;
+        }
+
+        frame[received++] = c;
+        if (received < length) continue;
+
+        switch (PROTOCOL_ID(frame[0]))
+        {
+            PROTOCOL_MESSAGES(PRINT_MESSAGE)
+        }
+        length = 0;
+    }
+    return 0;
+}
@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+# tracetimeline.py
+# Turns a trace dump from the handset (see Trace.h) into Chrome trace event JSON, for viewing as a timeline in
+# chrome://tracing or ui.perfetto.dev. Capture the dump from USART0 at 38400 baud first, e.g.
+#   stty -F /dev/ttyUSB0 38400 raw && cat /dev/ttyUSB0 > trace.bin   (then tap Dump on the trace page)
+#   python3 Tools/tracetimeline.py trace.bin -o trace.json
+# Event and ISR names are read from the firmware headers, so they never go stale.
+
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+
+FIRMWARE = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'HexapodControllerFirmware.X')
+MAGIC = b'TRC'
+VERSION = 1
+RECORD = struct.Struct('<BBHH') # TraceRecord: event, overflows, time, payload
+COUNTS_PER_MICROSECOND = 2 # Timer3 at 2MHz
+COMMENT = re.compile(r'//[^\n]*|/\*.*?\*/', re.S)
+
+
+def enum_names(path, name):
+    # Enumerators in order, assuming none has an explicit value
+    source = COMMENT.sub('', open(path).read())
+    match = re.search(r'enum\s+%s\s*\{(.*?)\}' % name, source, re.S)
+    if not match:
+        sys.exit('%s: no enum %s' % (path, name))
+    body = '\n'.join(line for line in match.group(1).split('\n') if not line.strip().startswith('#'))
+    return [n.strip() for n in body.split(',') if n.strip() and not n.strip().startswith('NUM_')]
+
+
+def read_dump(data):
+    start = data.find(MAGIC)
+    if start < 0 or len(data) < start + 6:
+        sys.exit('No trace dump found')
+    version, count = struct.unpack_from('<BH', data, start + 3)
+    if version != VERSION:
+        sys.exit('Dump is version %d, expected %d' % (version, VERSION))
+    records = data[start + 6:start + 6 + count*RECORD.size]
+    if len(records) < count*RECORD.size:
+        print('Dump truncated, %d of %d records' % (len(records) // RECORD.size, count), file=sys.stderr)
+    return [RECORD.unpack_from(records, n) for n in range(0, len(records) - RECORD.size + 1, RECORD.size)]
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert a handset trace dump to Chrome trace JSON')
+    parser.add_argument('dump', help='raw bytes captured from USART0')
+    parser.add_argument('--firmware', default=FIRMWARE, help='directory holding Trace.h and Profiler.h')
+    parser.add_argument('-o', '--output', default='trace.json')
+    args = parser.parse_args()
+
+    events = enum_names(os.path.join(args.firmware, 'Trace.h'), 'TraceEvents')
+    isrs = enum_names(os.path.join(args.firmware, 'Profiler.h'), 'ProfiledIsrs')
+    records = read_dump(open(args.dump, 'rb').read())
+
+    out = []
+    stacks = {} # Open spans per thread, so spans cut in half by the ring wrapping can be dropped
+    wraps = 0
+    last_overflows = None
+    for event, overflows, time, payload in records:
+        # Only the low byte of the overflow count is stored, so count its own wraps assuming no gap over 8 seconds
+        if last_overflows is not None and overflows < last_overflows:
+            wraps += 1
+        last_overflows = overflows
+        ts = ((wraps*256 + overflows)*65536 + time) / COUNTS_PER_MICROSECOND
+
+        name = events[event] if event < len(events) else 'EVENT_%d' % event
+        base = re.sub(r'^TRACE_|_(BEGIN|END)$', '', name).lower()
+        tid = 'ISRs' if base == 'isr' else 'Main loop'
+        entry = {'name': base, 'ts': ts, 'pid': 0, 'tid': tid, 'args': {'payload': payload}}
+        if base == 'isr':
+            entry['name'] = isrs[payload][len('PROFILE_'):] if payload < len(isrs) else 'ISR %d' % payload
+        elif base == 'char':
+            entry['args']['payload'] = chr(payload) if 32 <= payload < 127 else payload
+
+        stack = stacks.setdefault(tid, [])
+        if name.endswith('_BEGIN'):
+            entry['ph'] = 'B'
+            stack.append(base)
+        elif name.endswith('_END'):
+            if base not in stack:
+                continue # Its begin was overwritten
+            while stack.pop() != base:
+                pass
+            entry['ph'] = 'E'
+        else:
+            entry['ph'] = 'i'
+            entry['s'] = 't'
+        out.append(entry)
+
+    if records:
+        print('%d records over %.1fms' % (len(records), (out[-1]['ts'] - out[0]['ts']) / 1000 if out else 0))
+    json.dump({'traceEvents': out, 'displayTimeUnit': 'ms'}, open(args.output, 'w'), indent=1)
+
+
+if __name__ == '__main__':
+    main()